@@ -42,6 +42,8 @@
 //#define SUPPORT_HIGH_DPI            1
 //
 //#define SUPPORT_GAMEPAD
+// Measure GPU frame time using timer queries (if supported), results available with GetGpuFrameTime()
+#define SUPPORT_GPU_TIMERS          1
 
 
 //------------------------------------------------------------------------------------
@@ -119,6 +119,9 @@
 
 #include "utils.h"              // Required for: fopen() Android mapping
 
+#define RGIF_IMPLEMENTATION
+#include "rgif.h"               // Required for: GIF writing [Used in BeginFrameCapture()]
+
 #if defined(SUPPORT_GESTURES_SYSTEM)
     #define GESTURES_IMPLEMENTATION
     #include "gestures.h"       // Gestures detection functionality
@@ -160,6 +163,11 @@
     #define CHDIR chdir
 #endif
 
+#if !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #include <pthread.h>            // Required for: pthread_create(), pthread_join() [Used in TakeScreenshotAsync() and frame capture]
+    #define ENCODER_THREAD          // Asynchronous screenshots and captured frames are encoded on a worker thread
+#endif
+
 #if defined(PLATFORM_DESKTOP)
     #define GLFW_INCLUDE_NONE       // Disable the standard OpenGL header inclusion on GLFW3
                                     // NOTE: Already provided by rlgl implementation (on glad.h)
@@ -269,10 +277,41 @@
 
 #define STORAGE_FILENAME        "storage.data"
 
+#define MAX_ENCODER_JOBS          8         // Max number of screenshots and captured frames waiting to be encoded
+
+// Encoder job types
+#define ENCODER_JOB_SCREENSHOT    0         // Save screenshot (TakeScreenshotAsync())
+#define ENCODER_JOB_FRAME         1         // Write captured frame
+#define ENCODER_JOB_CAPTURE_END   2         // Close frame capture file
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Frame capture data, owned by encoder once capture begins (BeginFrameCapture())
+typedef struct FrameCapture {
+    int format;                     // Capture format (CaptureFormat)
+    int width;                      // Frames width
+    int height;                     // Frames height
+    FILE *file;                     // Capture file (Y4M and raw formats)
+    GifWriter *gif;                 // GIF writer (GIF format)
+    unsigned char *buffer;          // Frame conversion buffer (Y4M format)
+    int framesWritten;              // Frames written to file
+    char path[512];                 // Capture file path
+} FrameCapture;
+
+// Screen readback requested: asynchronous screenshot or captured frame
+typedef struct ReadbackRequest {
+    FrameCapture *capture;          // Frame capture the frame belongs to (NULL for screenshots)
+    char path[512];                 // Screenshot file path
+} ReadbackRequest;
+
+// Encoder job: screenshot to save, captured frame to write or frame capture to close
+typedef struct EncoderJob {
+    int type;                       // Job type (ENCODER_JOB_*)
+    Image image;                    // Screenshot or frame image (data owned by job)
+    FrameCapture *capture;          // Frame capture (frames and capture end)
+    char path[512];                 // Screenshot file path
+} EncoderJob;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -431,6 +470,29 @@ static int dirFilesCount = 0;               // Count directory files strings
 
 //-----------------------------------------------------------------------------------
 
+// Asynchronous screenshots and frame capture variables
+//-----------------------------------------------------------------------------------
+static ReadbackRequest readbackRequests[MAX_SCREEN_READBACKS] = { 0 };  // Screen readbacks requested (FIFO, same order as rlgl)
+static int readbackRequestFirst = 0;        // Oldest readback request
+static int readbackRequestsCount = 0;       // Readback requests waiting for screen pixels
+
+static FrameCapture *frameCapture = NULL;   // Current frame capture (NULL if not capturing)
+static int frameCaptureRequested = 0;       // Frames captured on current capture
+static int frameCaptureDropped = 0;         // Frames dropped on current capture (readbacks or encoder busy)
+
+#if defined(ENCODER_THREAD)
+static EncoderJob encoderJobs[MAX_ENCODER_JOBS] = { 0 };    // Jobs waiting to be encoded (FIFO)
+static int encoderJobFirst = 0;             // Oldest encoder job
+static int encoderJobsCount = 0;            // Encoder jobs waiting
+static pthread_t encoderThreadId;           // Encoder thread id
+static bool encoderThreadReady = false;     // Encoder thread running
+static bool encoderThreadExit = false;      // Encoder thread exit requested (once jobs done)
+static pthread_mutex_t encoderMutex = PTHREAD_MUTEX_INITIALIZER;            // Encoder jobs access mutex
+static pthread_cond_t encoderCondition = PTHREAD_COND_INITIALIZER;          // Encoder jobs available (or exit requested)
+static pthread_cond_t encoderSpaceCondition = PTHREAD_COND_INITIALIZER;     // Encoder jobs queue slot freed
+#endif
+//-----------------------------------------------------------------------------------
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by core)
 //----------------------------------------------------------------------------------
@@ -450,6 +512,17 @@ static void SwapBuffers(void);                          // Copy back buffer to f
 static void InitTimer(void);                            // Initialize timer
 static void Wait(float ms);                             // Wait for some milliseconds (stop program execution)
 
+static void GetOutputFilePath(const char *fileName, char *path);    // Get output file path (internal data path on Android)
+static void SaveScreenshot(Image image, const char *path);          // Export screenshot image and free its data
+static void WriteCaptureFrame(FrameCapture *capture, Image image);  // Write captured frame into capture file and free its data
+static void CloseFrameCapture(FrameCapture *capture);               // Close frame capture file and free capture data
+static void RunEncoderJob(EncoderJob *job);             // Run encoder job: save screenshot, write captured frame or close frame capture
+static bool SubmitEncoderJob(EncoderJob job, bool wait);            // Submit encoder job to encoder thread (if available)
+static void ProcessReadbacks(void);                     // Retrieve screen readbacks ready and submit them for encoding
+#if defined(ENCODER_THREAD)
+static void *EncoderThread(void *arg);                  // Encoder thread (screenshots and captured frames)
+#endif
+
 static bool GetKeyStatus(int key);                      // Returns if a key has been pressed
 static bool GetMouseButtonStatus(int button);           // Returns if a mouse button has been pressed
 static int GetGamepadButton(int button);                // Get gamepad button generic to all platforms
@@ -691,6 +764,23 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+    // Wait for pending asynchronous screenshots and captured frames to be read back and saved
+    if (frameCapture != NULL) EndFrameCapture();
+    while (readbackRequestsCount > 0) ProcessReadbacks();
+
+#if defined(ENCODER_THREAD)
+    if (encoderThreadReady)
+    {
+        pthread_mutex_lock(&encoderMutex);
+        encoderThreadExit = true;
+        pthread_cond_signal(&encoderCondition);
+        pthread_mutex_unlock(&encoderMutex);
+
+        pthread_join(encoderThreadId, NULL);
+        encoderThreadReady = false;
+        encoderThreadExit = false;
+    }
+#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();
@@ -1183,6 +1273,9 @@ void BeginDrawing(void)
     updateTime = currentTime - previousTime;
     previousTime = currentTime;
 
+    rlResetFrameStats();                // Reset renderer statistics for new frame
+    rlBeginGpuTimer(RL_GPU_TIMER_FRAME);    // Begin GPU frame timing (if GPU timers enabled)
+
     rlLoadIdentity();                   // Reset current matrix (MODELVIEW)
     rlMultMatrixf(MatrixToFloat(screenScaling));       // Apply screen scaling
 
@@ -1201,8 +1294,27 @@ void EndDrawing(void)
 
     rlglDraw();                     // Draw Buffers (Only OpenGL 3+ and ES2)
 
+    rlEndGpuTimer(RL_GPU_TIMER_FRAME);  // End GPU frame timing, results resolved a few frames later
+
+    // Request frame capture readback (no wait for GPU, frame dropped if readbacks are busy)
+    if (frameCapture != NULL)
+    {
+        frameCaptureRequested++;
+
+        if ((renderWidth == frameCapture->width) && (renderHeight == frameCapture->height) &&
+            (readbackRequestsCount < MAX_SCREEN_READBACKS) && rlReadScreenPixelsAsync(renderWidth, renderHeight))
+        {
+            ReadbackRequest *request = &readbackRequests[(readbackRequestFirst + readbackRequestsCount)%MAX_SCREEN_READBACKS];
+            request->capture = frameCapture;
+            readbackRequestsCount++;
+        }
+        else frameCaptureDropped++;
+    }
+
     SwapBuffers();                  // Copy back buffer to front buffer
     PollInputEvents();              // Poll user events
+
+    ProcessReadbacks();             // Submit asynchronous screenshots and captured frames already read back
     
     // Frame time control system
     currentTime = GetTime();
@@ -1297,6 +1409,7 @@ void BeginTextureMode(RenderTexture2D target)
     rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
 
     rlEnableRenderTexture(target.id);   // Enable render target
+    rlBeginGpuTimer(RL_GPU_TIMER_TEXTURE_PASS);     // Begin render texture pass GPU timing
 
     // Set viewport to framebuffer size
     rlViewport(0, 0, target.texture.width, target.texture.height);
@@ -1324,6 +1437,8 @@ void EndTextureMode(void)
 {
     rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
 
+    rlEndGpuTimer(RL_GPU_TIMER_TEXTURE_PASS);       // End render texture pass GPU timing
+
     rlDisableRenderTexture();           // Disable render target
 
     // Set viewport to default framebuffer size
@@ -1336,19 +1451,17 @@ void EndTextureMode(void)
 
 // Begin scissor mode (define screen area for following drawing)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
+// NOTE: Scissor state is registered per draw call by rlgl, no need to force drawing elements
+// NOTE: Nested scissor modes are intersected with the enclosing one, drawing outside is culled on CPU when possible
 void BeginScissorMode(int x, int y, int width, int height)
 {
-    rlglDraw(); // Force drawing elements
-
-    rlEnableScissorTest();
-    rlScissor(x, GetScreenHeight() - (y + height), width, height);
+    rlPushScissor(x, GetScreenHeight() - (y + height), width, height);
 }
 
-// End scissor mode
+// End scissor mode (enclosing scissor mode area is restored)
 void EndScissorMode(void)
 {
-    rlglDraw(); // Force drawing elements
-    rlDisableScissorTest();
+    rlPopScissor();
 }
 
 // Returns a ray trace from mouse position
@@ -1506,6 +1619,14 @@ float GetFrameTime(void)
     return (float)frameTime;
 }
 
+// Returns GPU time in seconds for last timed frame
+// NOTE: GPU results come a few frames late (never waits for GPU), returns 0 if GPU timers not supported,
+// a GPU time close to frame time means frame is GPU-bound, a much lower one means it's CPU-bound
+float GetGpuFrameTime(void)
+{
+    return rlGetGpuTimings().frameTime;
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
@@ -1697,24 +1818,97 @@ void TakeScreenshot(const char *fileName)
     Image image = { imgData, renderWidth, renderHeight, 1, UNCOMPRESSED_R8G8B8A8 };
 
     char path[512] = { 0 };
-#if defined(PLATFORM_ANDROID)
-    strcpy(path, internalDataPath);
-    strcat(path, "/");
-    strcat(path, fileName);
-#else
-    strcpy(path, fileName);
-#endif
+    GetOutputFilePath(fileName, path);
 
-    ExportImage(image, path);
-    RL_FREE(imgData);
+    SaveScreenshot(image, path);
+}
 
-#if defined(PLATFORM_WEB)
-    // Download file from MEMFS (emscripten memory filesystem)
-    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
-    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
-#endif
+// Takes a screenshot of current screen without waiting for GPU (saved a .png a few frames later)
+// NOTE: Screen pixels are read back asynchronously and image is encoded on a worker thread (if available),
+// if too many screenshots are pending, screenshot is taken synchronously
+void TakeScreenshotAsync(const char *fileName)
+{
+    if ((readbackRequestsCount >= MAX_SCREEN_READBACKS) || !rlReadScreenPixelsAsync(renderWidth, renderHeight))
+    {
+        TraceLog(LOG_WARNING, "Asynchronous screenshots busy, screenshot taken synchronously");
+        TakeScreenshot(fileName);
+        return;
+    }
 
-    TraceLog(LOG_INFO, "Screenshot taken: %s", path);
+    ReadbackRequest *request = &readbackRequests[(readbackRequestFirst + readbackRequestsCount)%MAX_SCREEN_READBACKS];
+    request->capture = NULL;
+    GetOutputFilePath(fileName, request->path);
+    readbackRequestsCount++;
+}
+
+// Begin capturing every frame drawn into a file (CaptureFormat)
+// NOTE: Frames are read back asynchronously on EndDrawing() and written by encoder thread (if available),
+// frames are dropped instead of waiting when readbacks or encoder are busy. Frames rate is target FPS (60 if not set)
+void BeginFrameCapture(const char *fileName, int format)
+{
+    if (frameCapture != NULL)
+    {
+        TraceLog(LOG_WARNING, "Frame capture already running, end it before starting a new one");
+        return;
+    }
+
+    FrameCapture *capture = (FrameCapture *)RL_CALLOC(1, sizeof(FrameCapture));
+    capture->format = format;
+    capture->width = renderWidth;
+    capture->height = renderHeight;
+    GetOutputFilePath(fileName, capture->path);
+
+    int fps = (targetTime > 0.0)? (int)(1.0/targetTime + 0.5) : 60;
+
+    if (format == CAPTURE_GIF)
+    {
+        capture->gif = GifBegin(capture->path, capture->width, capture->height, fps);
+    }
+    else if ((format == CAPTURE_Y4M) || (format == CAPTURE_RAW))
+    {
+        capture->file = fopen(capture->path, "wb");
+
+        if ((capture->file != NULL) && (format == CAPTURE_Y4M))
+        {
+            int chromaSize = ((capture->width + 1)/2)*((capture->height + 1)/2);
+            capture->buffer = (unsigned char *)RL_MALLOC(capture->width*capture->height + 2*chromaSize);
+
+            fprintf(capture->file, "YUV4MPEG2 W%i H%i F%i:1 Ip A1:1 C420jpeg\n", capture->width, capture->height, fps);
+        }
+    }
+
+    if ((capture->gif == NULL) && (capture->file == NULL))
+    {
+        TraceLog(LOG_WARNING, "[%s] Frame capture file could not be created", capture->path);
+        RL_FREE(capture->buffer);
+        RL_FREE(capture);
+        return;
+    }
+
+    frameCapture = capture;
+    frameCaptureRequested = 0;
+    frameCaptureDropped = 0;
+
+    TraceLog(LOG_INFO, "Frame capture started: %s (%i x %i, %i fps)", capture->path, capture->width, capture->height, fps);
+}
+
+// End frame capture, frames pending are written and file is closed by encoder
+// NOTE: It waits for pending frames readbacks (at most a few frames of GPU work)
+void EndFrameCapture(void)
+{
+    if (frameCapture == NULL) return;
+
+    while (readbackRequestsCount > 0) ProcessReadbacks();
+
+    EncoderJob job = { 0 };
+    job.type = ENCODER_JOB_CAPTURE_END;
+    job.capture = frameCapture;
+
+    if (!SubmitEncoderJob(job, true)) RunEncoderJob(&job);
+
+    if (frameCaptureDropped > 0) TraceLog(LOG_WARNING, "Frame capture: %i of %i frames dropped (readbacks or encoder busy)", frameCaptureDropped, frameCaptureRequested);
+
+    frameCapture = NULL;
 }
 
 // Check if the file exists
@@ -3048,6 +3242,11 @@ static bool InitGraphicsDevice(int width, int height)
     // NOTE: screenWidth and screenHeight not used, just stored as globals in rlgl
     rlglInit(screenWidth, screenHeight);
 
+#if defined(SUPPORT_GPU_TIMERS)
+    // Enable GPU frame timing using timer queries, only if supported (no warning otherwise)
+    if (rlGpuTimersSupported()) rlEnableGpuTimers();
+#endif
+
     int fbWidth = renderWidth;
     int fbHeight = renderHeight;
 
@@ -3170,6 +3369,229 @@ static void SetupFramebuffer(int width, int height)
     }
 }
 
+// Get output file path (internal data path on Android)
+// NOTE: path must have space for 512 characters
+static void GetOutputFilePath(const char *fileName, char *path)
+{
+#if defined(PLATFORM_ANDROID)
+    strcpy(path, internalDataPath);
+    strcat(path, "/");
+    strcat(path, fileName);
+#else
+    strcpy(path, fileName);
+#endif
+}
+
+// Export screenshot image and free its data
+static void SaveScreenshot(Image image, const char *path)
+{
+    ExportImage(image, path);
+    RL_FREE(image.data);
+
+#if defined(PLATFORM_WEB)
+    // Download file from MEMFS (emscripten memory filesystem)
+    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
+#endif
+
+    TraceLog(LOG_INFO, "Screenshot taken: %s", path);
+}
+
+// Write captured frame into capture file and free its data
+static void WriteCaptureFrame(FrameCapture *capture, Image image)
+{
+    switch (capture->format)
+    {
+        case CAPTURE_GIF: GifWriteFrame(capture->gif, (unsigned char *)image.data); break;
+        case CAPTURE_Y4M:
+        {
+            // Convert to YUV 4:2:0 planes, BT.601 full range (C420jpeg)
+            int chromaWidth = (image.width + 1)/2;
+            int chromaHeight = (image.height + 1)/2;
+            unsigned char *planeY = capture->buffer;
+            unsigned char *planeU = planeY + image.width*image.height;
+            unsigned char *planeV = planeU + chromaWidth*chromaHeight;
+            const unsigned char *pixels = (const unsigned char *)image.data;
+
+            for (int i = 0; i < image.width*image.height; i++)
+            {
+                planeY[i] = (unsigned char)((77*pixels[i*4] + 150*pixels[i*4 + 1] + 29*pixels[i*4 + 2] + 128) >> 8);
+            }
+
+            for (int y = 0; y < chromaHeight; y++)
+            {
+                for (int x = 0; x < chromaWidth; x++)
+                {
+                    // Average 2x2 block (clamped to image borders)
+                    int r = 0, g = 0, b = 0, count = 0;
+
+                    for (int j = y*2; (j < y*2 + 2) && (j < image.height); j++)
+                    {
+                        for (int i = x*2; (i < x*2 + 2) && (i < image.width); i++)
+                        {
+                            const unsigned char *pixel = pixels + (j*image.width + i)*4;
+                            r += pixel[0];
+                            g += pixel[1];
+                            b += pixel[2];
+                            count++;
+                        }
+                    }
+
+                    r /= count;
+                    g /= count;
+                    b /= count;
+
+                    planeU[y*chromaWidth + x] = (unsigned char)(((-43*r - 85*g + 128*b + 128) >> 8) + 128);
+                    planeV[y*chromaWidth + x] = (unsigned char)(((128*r - 107*g - 21*b + 128) >> 8) + 128);
+                }
+            }
+
+            fputs("FRAME\n", capture->file);
+            fwrite(capture->buffer, 1, image.width*image.height + 2*chromaWidth*chromaHeight, capture->file);
+        } break;
+        case CAPTURE_RAW: fwrite(image.data, 1, image.width*image.height*4, capture->file); break;
+        default: break;
+    }
+
+    capture->framesWritten++;
+    RL_FREE(image.data);
+}
+
+// Close frame capture file and free capture data
+static void CloseFrameCapture(FrameCapture *capture)
+{
+    if (capture->format == CAPTURE_GIF) GifEnd(capture->gif);
+    else fclose(capture->file);
+
+    TraceLog(LOG_INFO, "Frame capture saved: %s (%i frames)", capture->path, capture->framesWritten);
+
+    RL_FREE(capture->buffer);
+    RL_FREE(capture);
+}
+
+// Run encoder job: save screenshot, write captured frame or close frame capture
+static void RunEncoderJob(EncoderJob *job)
+{
+    switch (job->type)
+    {
+        case ENCODER_JOB_SCREENSHOT: SaveScreenshot(job->image, job->path); break;
+        case ENCODER_JOB_FRAME: WriteCaptureFrame(job->capture, job->image); break;
+        case ENCODER_JOB_CAPTURE_END: CloseFrameCapture(job->capture); break;
+        default: break;
+    }
+}
+
+// Submit encoder job to encoder thread (if available), returns false if it could not be queued
+// NOTE: If wait is requested, it waits for a free slot on the jobs queue
+static bool SubmitEncoderJob(EncoderJob job, bool wait)
+{
+    bool queued = false;
+
+#if defined(ENCODER_THREAD)
+    if (!encoderThreadReady) encoderThreadReady = (pthread_create(&encoderThreadId, NULL, &EncoderThread, NULL) == 0);
+
+    if (encoderThreadReady)
+    {
+        pthread_mutex_lock(&encoderMutex);
+
+        if (wait) while (encoderJobsCount >= MAX_ENCODER_JOBS) pthread_cond_wait(&encoderSpaceCondition, &encoderMutex);
+
+        if (encoderJobsCount < MAX_ENCODER_JOBS)
+        {
+            encoderJobs[(encoderJobFirst + encoderJobsCount)%MAX_ENCODER_JOBS] = job;
+            encoderJobsCount++;
+            queued = true;
+
+            pthread_cond_signal(&encoderCondition);
+        }
+
+        pthread_mutex_unlock(&encoderMutex);
+    }
+#endif
+
+    return queued;
+}
+
+// Retrieve screen readbacks ready, in request order, and submit them for encoding
+// NOTE: Screenshots are saved on main thread if encoder thread is busy while captured frames are dropped,
+// both are written on main thread if there is no encoder thread
+static void ProcessReadbacks(void)
+{
+    while (readbackRequestsCount > 0)
+    {
+        int width = 0;
+        int height = 0;
+        unsigned char *pixels = rlGetScreenPixelsAsync(&width, &height);
+
+        if (pixels == NULL) break;      // Oldest readback not ready yet, newer ones neither
+
+        ReadbackRequest *request = &readbackRequests[readbackRequestFirst];
+
+        EncoderJob job = { 0 };
+        job.image = (Image){ pixels, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+        job.capture = request->capture;
+
+        if (request->capture == NULL)
+        {
+            job.type = ENCODER_JOB_SCREENSHOT;
+            strcpy(job.path, request->path);
+
+            if (!SubmitEncoderJob(job, false)) RunEncoderJob(&job);
+        }
+        else
+        {
+            job.type = ENCODER_JOB_FRAME;
+
+            if (!SubmitEncoderJob(job, false))
+            {
+#if defined(ENCODER_THREAD)
+                if (encoderThreadReady)
+                {
+                    RL_FREE(pixels);
+                    frameCaptureDropped++;
+                }
+                else RunEncoderJob(&job);
+#else
+                RunEncoderJob(&job);
+#endif
+            }
+        }
+
+        readbackRequestFirst = (readbackRequestFirst + 1)%MAX_SCREEN_READBACKS;
+        readbackRequestsCount--;
+    }
+}
+
+#if defined(ENCODER_THREAD)
+// Encoder thread, runs queued jobs until exit is requested and no jobs are left
+static void *EncoderThread(void *arg)
+{
+    pthread_mutex_lock(&encoderMutex);
+
+    while (true)
+    {
+        while ((encoderJobsCount == 0) && !encoderThreadExit) pthread_cond_wait(&encoderCondition, &encoderMutex);
+
+        if (encoderJobsCount == 0) break;
+
+        EncoderJob job = encoderJobs[encoderJobFirst];
+        encoderJobFirst = (encoderJobFirst + 1)%MAX_ENCODER_JOBS;
+        encoderJobsCount--;
+
+        pthread_cond_signal(&encoderSpaceCondition);
+
+        // NOTE: Encoding is done without holding the lock, main thread can keep queuing jobs
+        pthread_mutex_unlock(&encoderMutex);
+        RunEncoderJob(&job);
+        pthread_mutex_lock(&encoderMutex);
+    }
+
+    pthread_mutex_unlock(&encoderMutex);
+
+    return NULL;
+}
+#endif
+
 // Initialize hi-resolution timer
 static void InitTimer(void)
 {
@@ -30,7 +30,7 @@
 *       [raudio] miniaudio (github.com/dr-soft/miniaudio) for audio device/context management
 *
 *   OPTIONAL DEPENDENCIES (included):
-*       [core] rgif (Charlie Tangora, Ramon Santamaria) for GIF recording
+*       [core] rgif (raylib contributors) for GIF recording (frame capture)
 *       [textures] stb_image (Sean Barret) for images loading (BMP, TGA, PNG, JPEG, HDR...)
 *       [textures] stb_image_write (Sean Barret) for image writting (BMP, TGA, PNG, JPG)
 *       [textures] stb_image_resize (Sean Barret) for image resizing algorithms
@@ -107,6 +107,9 @@ extern char* rayPrevKeyState;
 #ifndef RL_CALLOC
     #define RL_CALLOC(n,sz)     calloc(n,sz)
 #endif
+#ifndef RL_REALLOC
+    #define RL_REALLOC(p,sz)    realloc(p,sz)
+#endif
 #ifndef RL_FREE
     #define RL_FREE(p)          free(p)
 #endif
@@ -260,6 +263,16 @@ typedef struct NPatchInfo {
     int type;              // layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// Sprite instance data, used by DrawTextureInstanced()
+// NOTE: Same parameters than DrawTexturePro(), 48 bytes per instance
+typedef struct SpriteInstance {
+    Rectangle sourceRec;   // Region in the texture (negative width/height flip the region)
+    Rectangle destRec;     // Region in the screen
+    Vector2 origin;        // Rotation origin, relative to destRec
+    float rotation;        // Rotation in degrees
+    Color tint;            // Tint color
+} SpriteInstance;
+
 // Font character info
 typedef struct CharInfo {
     int value;              // Character value (Unicode)
@@ -847,6 +860,13 @@ typedef enum {
     NPT_3PATCH_HORIZONTAL   // Npatch defined by 3x1 tiles
 } NPatchType;
 
+// Frame capture formats
+typedef enum {
+    CAPTURE_GIF = 0,        // Animated GIF (fixed 256 colors palette, dithered)
+    CAPTURE_Y4M,            // YUV4MPEG2 video (YUV 4:2:0, uncompressed)
+    CAPTURE_RAW             // Raw RGBA 32bit frames (no header)
+} CaptureFormat;
+
 // Callbacks to be implemented by users
 typedef void (*TraceLogCallback)(int logType, const char *text, va_list args);
 
@@ -910,8 +930,8 @@ RLAPI void BeginMode3D(Camera3D camera);                          // Initializes
 RLAPI void EndMode3D(void);                                       // Ends 3D mode and returns to default 2D orthographic mode
 RLAPI void BeginTextureMode(RenderTexture2D target);              // Initializes render texture for drawing
 RLAPI void EndTextureMode(void);                                  // Ends drawing to render texture
-RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
-RLAPI void EndScissorMode(void);                                  // End scissor mode
+RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing, nested areas are intersected)
+RLAPI void EndScissorMode(void);                                  // End scissor mode (enclosing area is restored)
 
 // Screen-space-related functions
 RLAPI Ray GetMouseRay(Vector2 mousePosition, Camera camera);      // Returns a ray trace from mouse position
@@ -925,6 +945,7 @@ RLAPI Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera); // Returns
 RLAPI void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
 RLAPI int GetFPS(void);                                           // Returns current FPS
 RLAPI float GetFrameTime(void);                                   // Returns time in seconds for last frame drawn
+RLAPI float GetGpuFrameTime(void);                                // Returns GPU time in seconds for last timed frame (a few frames late)
 RLAPI double GetTime(void);                                       // Returns elapsed time in seconds since InitWindow()
 
 // Color-related functions
@@ -943,6 +964,9 @@ RLAPI void SetTraceLogExit(int logType);                          // Set the exi
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);        // Set a trace log callback to enable custom logging
 RLAPI void TraceLog(int logType, const char *text, ...);          // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR)
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (saved a .png)
+RLAPI void TakeScreenshotAsync(const char *fileName);             // Takes a screenshot of current screen without waiting for GPU (saved a .png a few frames later)
+RLAPI void BeginFrameCapture(const char *fileName, int format);   // Begin capturing every frame drawn into a file (CaptureFormat), written on background
+RLAPI void EndFrameCapture(void);                                 // End frame capture, pending frames are written and file closed
 RLAPI int GetRandomValue(int min, int max);                       // Returns a random value between min and max (both included)
 
 // Files management functions
@@ -1110,6 +1134,7 @@ RLAPI int GetPixelDataSize(int width, int height, int format);
 RLAPI Image GetTextureData(Texture2D texture);                                                           // Get pixel data from GPU texture and return an Image
 RLAPI Image GetScreenData(void);                                                                         // Get pixel data from screen buffer and return an Image (screenshot)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
+RLAPI void UpdateTextureAsync(Texture2D texture, const void *pixels);                                    // Update GPU texture with new data, without waiting for the transfer
 
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
@@ -1167,6 +1192,7 @@ RLAPI void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, fl
 RLAPI void DrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint);         // Draw a part of a texture defined by a rectangle
 RLAPI void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint);  // Draw texture quad with tiling and offset parameters
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint);       // Draw a part of a texture defined by a rectangle with 'pro' parameters
+RLAPI void DrawTextureInstanced(Texture2D texture, const SpriteInstance *instances, int count);                                       // Draw multiple parts of a texture with 'pro' parameters, using instancing if supported
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle destRec, Vector2 origin, float rotation, Color tint);  // Draws a texture (or part of it) that stretches or shrinks nicely
 
 //------------------------------------------------------------------------------------
@@ -1318,6 +1344,7 @@ RLAPI char *LoadText(const char *fileName);                               // Loa
 RLAPI Shader LoadShader(const char *vsFileName, const char *fsFileName);  // Load shader from files and bind default locations
 RLAPI Shader LoadShaderCode(const char *vsCode, const char *fsCode);                  // Load shader from code strings and bind default locations
 RLAPI void UnloadShader(Shader shader);                                   // Unload shader from GPU memory (VRAM)
+RLAPI void SetShaderCachePath(const char *dirPath);                       // Set shader program binaries cache directory (NULL to disable cache)
 
 RLAPI Shader GetShaderDefault(void);                                      // Get default shader
 RLAPI Texture2D GetTextureDefault(void);                                  // Get default texture
@@ -0,0 +1,376 @@
+/**********************************************************************************************
+*
+*   rgif - Minimal animated GIF writer (used for frame capture)
+*
+*   Frames are quantized to a fixed 256 colors palette (RGB 3-3-2) with ordered dithering
+*   and LZW compressed. Quantization needs no per-frame palette computation, so frames can
+*   be written as they come, at the cost of color accuracy.
+*
+*   Frame delays are in hundredths of second, rounding error is accumulated along frames to keep
+*   animation speed (i.e. 30 fps is written as 3, 4, 3 delays). Most GIF viewers clamp delays
+*   below 2 hundredths, so frame rates above 50 fps are played at 50 fps.
+*
+*   CONFIGURATION:
+*
+*   #define RGIF_IMPLEMENTATION
+*       Generates the implementation of the library into the included file.
+*       If not defined, the library is in header only mode and can be included in other headers
+*       or source files without problems. But only ONE file should hold the implementation.
+*
+*   #define RGIF_MALLOC()
+*   #define RGIF_FREE()
+*       Define to use custom memory allocators, by default RL_MALLOC()/RL_FREE() if available,
+*       standard malloc()/free() otherwise.
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 raylib contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RGIF_H
+#define RGIF_H
+
+#include <stdbool.h>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if defined(_WIN32) && defined(BUILD_LIBTYPE_SHARED)
+    #define RGIFAPI __declspec(dllexport)         // We are building library as a Win32 shared library (.dll)
+#elif defined(_WIN32) && defined(USE_LIBTYPE_SHARED)
+    #define RGIFAPI __declspec(dllimport)         // We are using library as a Win32 shared library (.dll)
+#else
+    #define RGIFAPI   // We are building or using library as a static library (or Linux shared library)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// GIF writer, opaque (internal data)
+typedef struct GifWriter GifWriter;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//------------------------------------------------------------------------------------
+// Functions Declaration
+//------------------------------------------------------------------------------------
+RGIFAPI GifWriter *GifBegin(const char *fileName, int width, int height, int fps);      // Create GIF file, frames written at fps rate (looping animation)
+RGIFAPI bool GifWriteFrame(GifWriter *gif, const unsigned char *pixels);               // Write frame from RGBA 32bit pixels (width*height, top-left origin)
+RGIFAPI void GifEnd(GifWriter *gif);                                                   // Close GIF file and free writer
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RGIF_H
+
+/***********************************************************************************
+*
+*   RGIF IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RGIF_IMPLEMENTATION)
+
+#include <stdio.h>              // Required for: FILE, fopen(), fwrite(), fputc(), fclose()
+#include <stdlib.h>             // Required for: malloc(), free()
+#include <string.h>             // Required for: memset()
+
+#if !defined(RGIF_MALLOC)
+    #if defined(RL_MALLOC)
+        #define RGIF_MALLOC(sz)     RL_MALLOC(sz)
+        #define RGIF_FREE(p)        RL_FREE(p)
+    #else
+        #define RGIF_MALLOC(sz)     malloc(sz)
+        #define RGIF_FREE(p)        free(p)
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GIF_LZW_MIN_CODE_SIZE       8       // Palette indices bits
+#define GIF_LZW_MAX_CODE         4095       // Max LZW code (12 bits), dictionary is reset once reached
+#define GIF_LZW_HASH_BITS          13       // LZW dictionary hash table size (8192 entries, at most half used)
+#define GIF_MIN_DELAY               2       // Minimum frame delay in hundredths of second (lower delays clamped by viewers)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// GIF writer data
+struct GifWriter {
+    FILE *file;                 // GIF file
+    int width;                  // Frames width
+    int height;                 // Frames height
+    int fps;                    // Frames per second
+    int frameCounter;           // Frames written in current second (delays rounding error accumulation)
+    unsigned char *indices;     // Frame palette indices (width*height)
+    int *hashKeys;              // LZW dictionary keys (prefix code and next index), -1 if empty
+    unsigned short *hashCodes;  // LZW dictionary codes
+};
+
+// LZW codes bit packing into data sub-blocks
+typedef struct GifBitWriter {
+    FILE *file;                 // GIF file
+    unsigned int bits;          // Pending bits (LSB first)
+    int bitCount;               // Pending bits count
+    unsigned char block[255];   // Current data sub-block
+    int blockSize;              // Current data sub-block size
+} GifBitWriter;
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static void GifWriteCode(GifBitWriter *writer, int code, int codeSize);    // Write LZW code into data sub-blocks
+static void GifQuantize(GifWriter *gif, const unsigned char *pixels);      // Quantize RGBA pixels to fixed palette indices
+static void GifCompress(GifWriter *gif);                                   // Write frame indices LZW compressed
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Create GIF file, writes header, global palette and looping extension
+GifWriter *GifBegin(const char *fileName, int width, int height, int fps)
+{
+    if (fps <= 0) return NULL;
+
+    FILE *file = fopen(fileName, "wb");
+    if (file == NULL) return NULL;
+
+    GifWriter *gif = (GifWriter *)RGIF_MALLOC(sizeof(GifWriter));
+    gif->file = file;
+    gif->width = width;
+    gif->height = height;
+    gif->fps = fps;
+    gif->frameCounter = 0;
+    gif->indices = (unsigned char *)RGIF_MALLOC(width*height);
+    gif->hashKeys = (int *)RGIF_MALLOC((1 << GIF_LZW_HASH_BITS)*sizeof(int));
+    gif->hashCodes = (unsigned short *)RGIF_MALLOC((1 << GIF_LZW_HASH_BITS)*sizeof(unsigned short));
+
+    // Header and logical screen descriptor (global color table of 256 colors)
+    fwrite("GIF89a", 1, 6, file);
+    fputc(width & 0xff, file);
+    fputc((width >> 8) & 0xff, file);
+    fputc(height & 0xff, file);
+    fputc((height >> 8) & 0xff, file);
+    fputc(0xf7, file);      // Global color table, 8 bits color resolution, 2^(7 + 1) colors
+    fputc(0, file);         // Background color index
+    fputc(0, file);         // Pixel aspect ratio (not specified)
+
+    // Global color table: RGB 3-3-2 palette
+    for (int i = 0; i < 256; i++)
+    {
+        fputc(((i >> 5) & 7)*255/7, file);
+        fputc(((i >> 2) & 7)*255/7, file);
+        fputc((i & 3)*255/3, file);
+    }
+
+    // Application extension: loop animation forever
+    fputc(0x21, file);
+    fputc(0xff, file);
+    fputc(11, file);
+    fwrite("NETSCAPE2.0", 1, 11, file);
+    fputc(3, file);
+    fputc(1, file);
+    fputc(0, file);         // Loop count (0 means forever)
+    fputc(0, file);
+    fputc(0, file);
+
+    return gif;
+}
+
+// Write frame from RGBA 32bit pixels
+bool GifWriteFrame(GifWriter *gif, const unsigned char *pixels)
+{
+    if ((gif == NULL) || (pixels == NULL)) return false;
+
+    FILE *file = gif->file;
+
+    // Frame delay: frame end time minus frame start time, rounded to hundredths of second
+    // NOTE: Frame counter wraps every second, delays along a full second always sum 100 hundredths
+    int delay = (100*(gif->frameCounter + 1) + gif->fps/2)/gif->fps - (100*gif->frameCounter + gif->fps/2)/gif->fps;
+    if (delay < GIF_MIN_DELAY) delay = GIF_MIN_DELAY;
+
+    gif->frameCounter = (gif->frameCounter + 1)%gif->fps;
+
+    // Graphic control extension: frame delay
+    fputc(0x21, file);
+    fputc(0xf9, file);
+    fputc(4, file);
+    fputc(0, file);         // No transparency, no disposal specified
+    fputc(delay & 0xff, file);
+    fputc((delay >> 8) & 0xff, file);
+    fputc(0, file);         // Transparent color index (not used)
+    fputc(0, file);
+
+    // Image descriptor: full frame, uses global color table
+    fputc(0x2c, file);
+    fputc(0, file);
+    fputc(0, file);
+    fputc(0, file);
+    fputc(0, file);
+    fputc(gif->width & 0xff, file);
+    fputc((gif->width >> 8) & 0xff, file);
+    fputc(gif->height & 0xff, file);
+    fputc((gif->height >> 8) & 0xff, file);
+    fputc(0, file);
+
+    GifQuantize(gif, pixels);
+    GifCompress(gif);
+
+    return (ferror(file) == 0);
+}
+
+// Close GIF file and free writer
+void GifEnd(GifWriter *gif)
+{
+    if (gif == NULL) return;
+
+    fputc(0x3b, gif->file);     // Trailer
+    fclose(gif->file);
+
+    RGIF_FREE(gif->indices);
+    RGIF_FREE(gif->hashKeys);
+    RGIF_FREE(gif->hashCodes);
+    RGIF_FREE(gif);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Write LZW code into data sub-blocks (LSB first, sub-blocks of up to 255 bytes)
+static void GifWriteCode(GifBitWriter *writer, int code, int codeSize)
+{
+    writer->bits |= (unsigned int)code << writer->bitCount;
+    writer->bitCount += codeSize;
+
+    while (writer->bitCount >= 8)
+    {
+        writer->block[writer->blockSize++] = (unsigned char)(writer->bits & 0xff);
+        writer->bits >>= 8;
+        writer->bitCount -= 8;
+
+        if (writer->blockSize == 255)
+        {
+            fputc(255, writer->file);
+            fwrite(writer->block, 1, 255, writer->file);
+            writer->blockSize = 0;
+        }
+    }
+}
+
+// Quantize RGBA pixels to RGB 3-3-2 palette indices, using 4x4 ordered dithering
+static void GifQuantize(GifWriter *gif, const unsigned char *pixels)
+{
+    static const int bayer[4][4] = { { 0, 8, 2, 10 }, { 12, 4, 14, 6 }, { 3, 11, 1, 9 }, { 15, 7, 13, 5 } };
+
+    for (int y = 0; y < gif->height; y++)
+    {
+        const unsigned char *row = pixels + y*gif->width*4;
+        unsigned char *indices = gif->indices + y*gif->width;
+
+        for (int x = 0; x < gif->width; x++)
+        {
+            // NOTE: Level is floor(value*levels/255 + threshold), threshold = (bayer + 0.5)/16
+            int threshold = (2*bayer[y & 3][x & 3] + 1)*255;
+            int r = (row[x*4]*7*32 + threshold)/(255*32);
+            int g = (row[x*4 + 1]*7*32 + threshold)/(255*32);
+            int b = (row[x*4 + 2]*3*32 + threshold)/(255*32);
+
+            indices[x] = (unsigned char)((r << 5) | (g << 2) | b);
+        }
+    }
+}
+
+// Write frame indices LZW compressed (image data)
+// NOTE: Dictionary is a hash table of (prefix code, next index) keys, it's reset when max code is reached
+static void GifCompress(GifWriter *gif)
+{
+    const int clearCode = 1 << GIF_LZW_MIN_CODE_SIZE;
+    const int endCode = clearCode + 1;
+    const int hashMask = (1 << GIF_LZW_HASH_BITS) - 1;
+
+    GifBitWriter writer = { 0 };
+    writer.file = gif->file;
+
+    int codeSize = GIF_LZW_MIN_CODE_SIZE + 1;
+    int nextCode = endCode + 1;
+    memset(gif->hashKeys, 0xff, (1 << GIF_LZW_HASH_BITS)*sizeof(int));
+
+    fputc(GIF_LZW_MIN_CODE_SIZE, gif->file);
+    GifWriteCode(&writer, clearCode, codeSize);
+
+    int count = gif->width*gif->height;
+    int prefix = gif->indices[0];
+
+    for (int i = 1; i < count; i++)
+    {
+        int index = gif->indices[i];
+        int key = (prefix << 8) | index;
+        int hash = (int)(((unsigned int)key*2654435761u) >> (32 - GIF_LZW_HASH_BITS));
+
+        while ((gif->hashKeys[hash] != -1) && (gif->hashKeys[hash] != key)) hash = (hash + 1) & hashMask;
+
+        // String already in dictionary, keep extending it
+        if (gif->hashKeys[hash] == key)
+        {
+            prefix = gif->hashCodes[hash];
+            continue;
+        }
+
+        GifWriteCode(&writer, prefix, codeSize);
+
+        gif->hashKeys[hash] = key;
+        gif->hashCodes[hash] = (unsigned short)nextCode;
+
+        // NOTE: Code size grows once the code just added does not fit, decoder follows one code behind
+        if (nextCode >= (1 << codeSize)) codeSize++;
+
+        if (nextCode == GIF_LZW_MAX_CODE)
+        {
+            GifWriteCode(&writer, clearCode, codeSize);
+            memset(gif->hashKeys, 0xff, (1 << GIF_LZW_HASH_BITS)*sizeof(int));
+            codeSize = GIF_LZW_MIN_CODE_SIZE + 1;
+            nextCode = endCode + 1;
+        }
+        else nextCode++;
+
+        prefix = index;
+    }
+
+    GifWriteCode(&writer, prefix, codeSize);
+    GifWriteCode(&writer, endCode, codeSize);
+
+    // Flush pending bits and sub-block, data ends with an empty sub-block
+    if (writer.bitCount > 0) GifWriteCode(&writer, 0, 8 - writer.bitCount);
+    if (writer.blockSize > 0)
+    {
+        fputc(writer.blockSize, gif->file);
+        fwrite(writer.block, 1, writer.blockSize, gif->file);
+    }
+    fputc(0, gif->file);
+}
+
+#endif  // RGIF_IMPLEMENTATION
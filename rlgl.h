@@ -21,6 +21,15 @@
 *       Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *       required by any other module, use rlGetVersion() tocheck it
 *
+*   #define GRAPHICS_API_NONE
+*       Use record backend, no OpenGL library or context required: batch flushes and resources
+*       operations are recorded as commands, check rlGetRecordCommands() (testing, benchmarking)
+*
+*   #define GRAPHICS_API_SOFTWARE
+*       Use software backend, record backend rasterizing batch draws on CPU (multithreaded, requires pthreads),
+*       default framebuffer and render textures pixels available with rlReadScreenPixels()/rlReadTexturePixels()
+*       NOTE: Commands are not recorded, custom shaders and depth test are not supported
+*
 *   #define RLGL_IMPLEMENTATION
 *       Generates the implementation of the library into the included file.
 *       If not defined, the library is in header only mode and can be included in other headers
@@ -77,6 +86,9 @@
     #ifndef RL_CALLOC
         #define RL_CALLOC(n,sz)     calloc(n,sz)
     #endif
+    #ifndef RL_REALLOC
+        #define RL_REALLOC(p,sz)    realloc(p,sz)
+    #endif
     #ifndef RL_FREE
         #define RL_FREE(p)          free(p)
     #endif
@@ -86,6 +98,21 @@
 
 #include "raymath.h"            // Required for: Vector3, Matrix
 
+// Software backend is a record backend rasterizing batch draws
+#if defined(GRAPHICS_API_SOFTWARE) && !defined(GRAPHICS_API_NONE)
+    #define GRAPHICS_API_NONE
+#endif
+
+// Record backend uses OpenGL 3.3 code paths over an internal recording OpenGL layer
+#if defined(GRAPHICS_API_NONE)
+    #undef GRAPHICS_API_OPENGL_11
+    #undef GRAPHICS_API_OPENGL_21
+    #undef GRAPHICS_API_OPENGL_ES2
+    #if !defined(GRAPHICS_API_OPENGL_33)
+        #define GRAPHICS_API_OPENGL_33
+    #endif
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -115,7 +142,7 @@
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    // This is the maximum amount of elements (quads) per batch
+    // This is the default amount of elements (quads) per batch, it can be changed with rlSetBatchLimits()
     // NOTE: Be careful with text, every letter maps to a quad
     #define MAX_BATCH_ELEMENTS            8192
 #elif defined(GRAPHICS_API_OPENGL_ES2)
@@ -124,9 +151,14 @@
     #define MAX_BATCH_ELEMENTS            2048
 #endif
 
-#define MAX_BATCH_BUFFERING                  1      // Max number of buffers for batching (multi-buffering)
+#define MAX_BATCH_BUFFERING                  3      // Max number of buffers for batching (multi-buffering)
 #define MAX_MATRIX_STACK_SIZE               32      // Max size of Matrix stack
-#define MAX_DRAWCALL_REGISTERED            256      // Max draws by state changes (mode, texture)
+#define MAX_SCISSOR_STACK_SIZE              16      // Max size of scissor rectangles stack
+#define MAX_DRAWCALL_REGISTERED            256      // Default max draws by state changes (mode, texture), see rlSetBatchLimits()
+#define MAX_DEFERRED_MERGE_LOOKBACK         32      // Max previous draw groups checked to merge a draw call (deferred mode)
+#define MAX_BATCH_TEXTURES                   8      // Max textures per draw call (texture units), only with default shader
+#define MAX_BATCH_LAYERS                   256      // Max draw layers, draw calls are ordered by layer on rlglDraw(), see rlSetLayer()
+#define MAX_LAYER_DEPTH_STEPS             4096      // Max primitives per layer and frame with its own depth (depth sort mode), see rlSetDepthSortMode()
 
 // Shader and material limits
 #define MAX_SHADER_LOCATIONS                32      // Maximum number of predefined locations stored in shader struct
@@ -168,6 +200,52 @@ typedef enum { OPENGL_11 = 1, OPENGL_21, OPENGL_33, OPENGL_ES_20 } GlVersion;
 
 typedef unsigned char byte;
 
+// Quad vertex type, same interleaved layout used by internal batch buffers (28 bytes)
+// NOTE: Used by rlPushQuads(), 4 vertex per quad in RL_QUADS order
+typedef struct rlQuadVertex {
+    float x, y, z;              // Vertex position
+    float u, v;                 // Vertex texture coordinates
+    unsigned char r, g, b, a;   // Vertex color
+    unsigned char slot;         // Vertex texture slot (set internally, draw call texture unit)
+    unsigned char padding[3];   // Padding to keep 4 byte alignment
+} rlQuadVertex;
+
+// Renderer frame statistics, counters reset with rlResetFrameStats() (called on BeginDrawing())
+typedef struct rlFrameStats {
+    int flushes;                // Batch flushes (rlglDraw() with vertex data to draw)
+    int drawCalls;              // Draw calls submitted (batch, static batches, sprite instances, meshes)
+    int vertexCount;            // Vertex submitted (batch and static batches)
+    int textureBinds;           // Texture binds
+    int bytesUploaded;          // Vertex buffers bytes uploaded (batch and sprite instances)
+    int flushesBufferLimit;     // Flushes forced by batch buffer limit
+    int flushesDrawCallLimit;   // Flushes forced by batch draw calls limit
+    int flushesStateChange;     // Flushes requested by state changes (modes, render targets, instancing...), includes end of frame flush
+    int matrixPops;             // Matrix pops forced on rlEnd() buffer limit (modelview stack popped before flush)
+    int stateChangesSkipped;    // Redundant state changes skipped by GL state cache (programs, VAOs, textures, blending)
+    int uniformsSkipped;        // Redundant uniform uploads skipped by GL state cache (MVP, diffuse color and sampler)
+    int quadsCulled;            // Quads culled on CPU before entering the batch (fully outside scissor rectangle)
+    int primitivesCulled;       // 2D primitives rejected on CPU by view culling (fully outside visible area)
+} rlFrameStats;
+
+// GPU timer sections, measured with timestamp queries (rlBeginGpuTimer()/rlEndGpuTimer())
+typedef enum {
+    RL_GPU_TIMER_FRAME = 0,     // Full frame (BeginDrawing()/EndDrawing()), ends current timings frame
+    RL_GPU_TIMER_FLUSH,         // Default batch flushes (DrawBuffersDefault())
+    RL_GPU_TIMER_TEXTURE_PASS,  // Render texture passes (BeginTextureMode()/EndTextureMode())
+    RL_GPU_TIMER_MESH,          // Mesh draws (rlDrawMesh())
+    RL_GPU_TIMER_COUNT
+} rlGpuTimerType;
+
+// GPU timings (in seconds) of last resolved frame, results come with a few frames of latency
+typedef struct rlGpuTimings {
+    float frameTime;            // GPU time for full frame (render texture passes before BeginDrawing() not included)
+    float flushTime;            // GPU time spent on default batch flushes
+    float texturePassTime;      // GPU time spent on render texture passes (includes flushes and meshes drawn inside)
+    float meshTime;             // GPU time spent on mesh draws
+    int sections;               // Timed sections (including frame)
+    int latency;                // Frames submitted after timed frame before its results were available
+} rlGpuTimings;
+
 #if defined(RLGL_STANDALONE)
     #ifndef __cplusplus
     // Boolean type
@@ -412,6 +490,51 @@ typedef unsigned char byte;
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+#if defined(GRAPHICS_API_NONE)
+// Record backend command types
+typedef enum {
+    RL_RECORD_FLUSH = 0,            // Batch flush: vertex data and draw calls
+    RL_RECORD_DRAW,                 // Non-batched draw (meshes): params: mode, count, texture id (unit 0)
+    RL_RECORD_CLEAR,                // Framebuffer clear: params[0]: mask, color
+    RL_RECORD_VIEWPORT,             // Viewport: params: x, y, width, height
+    RL_RECORD_TEXTURE_LOAD,         // Texture loaded: params: width, height, format (OpenGL internal), target
+    RL_RECORD_TEXTURE_UPDATE,       // Texture updated: params: offsetX, offsetY, width, height
+    RL_RECORD_TEXTURE_UNLOAD,       // Texture unloaded
+    RL_RECORD_FRAMEBUFFER_LOAD,     // Framebuffer loaded
+    RL_RECORD_FRAMEBUFFER_ATTACH,   // Framebuffer attachment: params: attachment (OpenGL), texture/renderbuffer id
+    RL_RECORD_FRAMEBUFFER_UNLOAD,   // Framebuffer unloaded
+    RL_RECORD_SHADER_LOAD,          // Shader program loaded
+    RL_RECORD_SHADER_UNLOAD         // Shader program unloaded
+} rlRecordType;
+
+// Record backend draw call, registered on batch flush
+typedef struct rlRecordDraw {
+    int mode;                       // Drawing mode: RL_LINES, RL_TRIANGLES, RL_QUADS
+    int vertexOffset;               // First vertex of the draw (on flush vertex data)
+    int vertexCount;                // Number of vertex of the draw
+    unsigned int textures[MAX_BATCH_TEXTURES];  // Textures ids (vertex slot index)
+    int texturesCount;              // Number of textures used
+    unsigned int shaderId;          // Shader program id
+    int blendMode;                  // Blending mode
+    bool scissorEnabled;            // Scissor test enabled
+    int scissorRec[4];              // Scissor rectangle (x, y, width, height), bottom-left origin
+} rlRecordDraw;
+
+// Record backend command
+typedef struct rlRecordCommand {
+    int type;                       // Command type (rlRecordType)
+    unsigned int id;                // Resource id (texture, framebuffer, shader program), shader program for draws
+    unsigned int framebuffer;       // Framebuffer bound when command was recorded (0 for default framebuffer)
+    int params[4];                  // Command parameters, depend on type
+    float color[4];                 // Clear color (RL_RECORD_CLEAR)
+    Matrix mvp;                     // Modelview-projection matrix (RL_RECORD_FLUSH)
+    rlQuadVertex *vertices;         // Vertex data copy (RL_RECORD_FLUSH)
+    int vertexCount;                // Vertex data count (RL_RECORD_FLUSH)
+    rlRecordDraw *draws;            // Draw calls (RL_RECORD_FLUSH)
+    int drawsCount;                 // Draw calls count (RL_RECORD_FLUSH)
+} rlRecordCommand;
+#endif
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -440,6 +563,7 @@ RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (norm
 RLAPI void rlColor4ub(byte r, byte g, byte b, byte a);    // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlPushQuads(const rlQuadVertex *vertices, int count, unsigned int textureId);  // Push multiple quads vertex data (4 vertex per quad)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL equivalent functions (common to 1.1, 3.3+, ES2)
@@ -457,6 +581,8 @@ RLAPI void rlDisableBackfaceCulling(void);                    // Disable backfac
 RLAPI void rlEnableScissorTest(void);                         // Enable scissor test
 RLAPI void rlDisableScissorTest(void);                        // Disable scissor test
 RLAPI void rlScissor(int x, int y, int width, int height);    // Scissor test
+RLAPI void rlPushScissor(int x, int y, int width, int height);    // Push scissor rectangle (intersected with current one) and enable scissor test
+RLAPI void rlPopScissor(void);                                // Pop scissor rectangle (previous one restored, scissor test disabled on empty stack)
 RLAPI void rlEnableWireMode(void);                            // Enable wire mode
 RLAPI void rlDisableWireMode(void);                           // Disable wire mode
 RLAPI void rlDeleteTextures(unsigned int id);                 // Delete OpenGL texture from GPU
@@ -478,6 +604,36 @@ RLAPI void rlglDraw(void);                            // Update and draw default
 
 RLAPI int rlGetVersion(void);                         // Returns current OpenGL version
 RLAPI bool rlCheckBufferLimit(int vCount);            // Check internal buffer overflow for a given number of vertex
+RLAPI void rlSetBatchLimits(int elements, int drawCalls);  // Set batch limits: elements (quads) and draw calls per batch
+RLAPI void rlSetBatchGrowth(bool enabled);            // Set batch automatic growth (CPU arrays and GPU buffers) instead of forced draws
+RLAPI int rlGetFenceWaitCount(void);                  // Get number of times CPU had to wait for GPU to release a batch or texture upload buffer
+RLAPI void rlSetDeferredMode(bool enabled);           // Set deferred mode: merge compatible non-overlapping draw calls on rlglDraw()
+RLAPI void rlGetDrawCallCounts(int *registered, int *submitted);  // Get draw calls registered and submitted (after merging) on current frame
+RLAPI void rlSetLayer(int layer);                     // Set draw layer for following primitives [0..MAX_BATCH_LAYERS-1], higher layers are drawn on top
+RLAPI void rlSetDepthSortMode(bool enabled);          // Set depth sort mode: opaque draws front-to-back with depth test, translucent draws back-to-front
+RLAPI void rlSetViewCulling(bool enabled);            // Set view culling: 2D draws fully outside visible area are rejected before vertex work
+RLAPI bool rlCheckViewCulled(float xmin, float ymin, float xmax, float ymax);  // Check 2D bounds (current transform space) are fully outside visible area (view culling)
+RLAPI rlFrameStats rlGetFrameStats(void);             // Get renderer statistics for current frame
+RLAPI void rlResetFrameStats(void);                   // Reset renderer statistics (new frame)
+RLAPI void rlResetStateCache(void);                   // Reset GL state cache (required after OpenGL calls issued outside rlgl)
+RLAPI void rlEnableGpuTimers(void);                   // Enable GPU timer queries (if supported, OpenGL 3.3 or EXT_disjoint_timer_query)
+RLAPI void rlDisableGpuTimers(void);                  // Disable GPU timer queries
+RLAPI bool rlGpuTimersSupported(void);                // Check GPU timer queries support
+RLAPI void rlBeginGpuTimer(int timer);                // Begin GPU timer section (first section begins a new timings frame)
+RLAPI void rlEndGpuTimer(int timer);                  // End GPU timer section (RL_GPU_TIMER_FRAME ends timings frame)
+RLAPI rlGpuTimings rlGetGpuTimings(void);             // Get GPU timings of last resolved frame (never waits for GPU)
+RLAPI void rlBeginStaticBatch(void);                  // Begin static batch capture: vertex data is captured instead of drawn
+RLAPI unsigned int rlEndStaticBatch(void);            // End static batch capture, upload captured vertex data to GPU, returns static batch id
+RLAPI void rlDrawStaticBatch(unsigned int id, Matrix transform);  // Draw static batch with a transform (applied before current modelview)
+RLAPI void rlUnloadStaticBatch(unsigned int id);      // Unload static batch from CPU and GPU memory
+RLAPI void rlEnableStereoRender(void);                // Enable stereo rendering: batch and meshes are drawn for both eyes
+RLAPI void rlDisableStereoRender(void);               // Disable stereo rendering
+RLAPI bool rlIsStereoRenderEnabled(void);             // Check if stereo rendering is enabled
+RLAPI void rlSetStereoView(int eye, Matrix proj, Matrix viewOffset, int x, int y, int width, int height);  // Set stereo eye (0: left, 1: right) projection, view offset and viewport
+#if defined(GRAPHICS_API_NONE)
+RLAPI const rlRecordCommand *rlGetRecordCommands(int *count);   // Get commands recorded by record backend
+RLAPI void rlResetRecordCommands(void);                         // Reset recorded commands (frees recorded vertex data)
+#endif
 RLAPI void rlSetDebugMarker(const char *text);        // Set debug marker for analysis
 RLAPI void rlLoadExtensions(void *loader);            // Load OpenGL extensions
 RLAPI Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view);  // Get world coordinates from screen coordinates
@@ -487,12 +643,15 @@ RLAPI unsigned int rlLoadTexture(void *data, int width, int height, int format,
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer);     // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(void *data, int size, int format);                        // Load texture cubemap
 RLAPI void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data); // Update GPU texture with new data
+RLAPI void rlUpdateTextureAsync(unsigned int id, int width, int height, int format, const void *data); // Update GPU texture with new data through pixel buffer objects (synchronous fallback)
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType);  // Get OpenGL internal formats
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 
 RLAPI void rlGenerateMipmaps(Texture2D *texture);                         // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(Texture2D texture);                       // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI bool rlReadScreenPixelsAsync(int width, int height);                // Request screen pixel data readback through pixel buffer objects (false if all readbacks busy)
+RLAPI unsigned char *rlGetScreenPixelsAsync(int *width, int *height);     // Get oldest requested screen pixel data, NULL if not ready yet (never waits)
 
 // Render texture management (fbo)
 RLAPI RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture);    // Load a render texture (with color and depth attachments)
@@ -505,6 +664,7 @@ RLAPI void rlUpdateMesh(Mesh mesh, int buffer, int num);                  // Upd
 RLAPI void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index);     // Update vertex or index data on GPU, at index
 RLAPI void rlDrawMesh(Mesh mesh, Material material, Matrix transform);    // Draw a 3d mesh with material and transform
 RLAPI void rlUnloadMesh(Mesh mesh);                                       // Unload mesh data from CPU and GPU
+RLAPI bool rlDrawSpriteInstances(unsigned int textureId, int width, int height, const void *instances, int count); // Draw sprite instances (48 bytes per instance), returns false if instancing not supported
 
 // NOTE: There is a set of shader related functions that are available to end user,
 // to avoid creating function wrappers through core module, they have been directly declared in raylib.h
@@ -519,6 +679,7 @@ RLAPI char *LoadText(const char *fileName);                               // Loa
 RLAPI Shader LoadShader(const char *vsFileName, const char *fsFileName);  // Load shader from files and bind default locations
 RLAPI Shader LoadShaderCode(const char *vsCode, const char *fsCode);                  // Load shader from code strings and bind default locations
 RLAPI void UnloadShader(Shader shader);                                   // Unload shader from GPU memory (VRAM)
+RLAPI void SetShaderCachePath(const char *dirPath);                       // Set shader program binaries cache directory (NULL to disable cache)
 
 RLAPI Shader GetShaderDefault(void);                                      // Get default shader
 RLAPI Texture2D GetTextureDefault(void);                                  // Get default texture
@@ -580,10 +741,20 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
     #endif
 #endif
 
-#include <stdio.h>                  // Required for: fopen(), fclose(), fread()... [Used only on LoadText()]
+#include <stdio.h>                  // Required for: fopen(), fclose(), fread()... [Used on LoadText() and shader cache]
 #include <stdlib.h>                 // Required for: malloc(), free(), rand()
-#include <string.h>                 // Required for: strcmp(), strlen(), strtok() [Used only in extensions loading]
+#include <string.h>                 // Required for: strcmp(), strlen(), strtok(), memcpy(), memcmp()
 #include <math.h>                   // Required for: atan2()
+#include <float.h>                  // Required for: FLT_MAX [Used only on deferred mode draw calls bounds]
+
+// SIMD intrinsics, used to transform batch vertex on rlglDraw() (scalar fallback if not available)
+#if defined(__AVX__)
+    #include <immintrin.h>              // Required for: AVX intrinsics
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>              // Required for: SSE2 intrinsics
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>               // Required for: NEON intrinsics
+#endif
 
 #if !defined(RLGL_STANDALONE)
     #include "raymath.h"            // Required for: Vector3 and Matrix functions
@@ -616,7 +787,13 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33)
-    #if defined(__APPLE__)
+    #if defined(GRAPHICS_API_NONE)
+        #include <stddef.h>             // Required for: ptrdiff_t [Used only on record backend OpenGL layer types]
+        #if defined(GRAPHICS_API_SOFTWARE) && !defined(_WIN32)
+            #include <pthread.h>        // Required for: pthread_create(), pthread_join() [Used only on software backend]
+            #include <unistd.h>         // Required for: sysconf() [Used only on software backend]
+        #endif
+    #elif defined(__APPLE__)
         #include <OpenGL/gl3.h>         // OpenGL 3 library for OSX
         #include <OpenGL/gl3ext.h>      // OpenGL 3 extensions library for OSX
     #else
@@ -639,3430 +816,8639 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
     #include <stdarg.h>                 // Required for: va_list, va_start(), vfprintf(), va_end() [Used only on TraceLog()]
 #endif
 
+#if defined(GRAPHICS_API_NONE)
 //----------------------------------------------------------------------------------
-// Defines and Macros
+// Record backend: OpenGL layer
+// NOTE: Only the OpenGL subset used by rlgl (OpenGL 3.3 code paths), no OpenGL call is made:
+// objects get fake ids and resources operations are registered as record commands,
+// features not supported by the layer are exposed as NULL function pointers
 //----------------------------------------------------------------------------------
-#ifndef GL_SHADING_LANGUAGE_VERSION
-    #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
+typedef unsigned int GLenum;
+typedef unsigned int GLuint;
+typedef int GLint;
+typedef int GLsizei;
+typedef unsigned int GLbitfield;
+typedef unsigned char GLboolean;
+typedef unsigned char GLubyte;
+typedef unsigned short GLushort;
+typedef float GLfloat;
+typedef double GLdouble;
+typedef char GLchar;
+typedef void GLvoid;
+typedef ptrdiff_t GLsizeiptr;
+typedef ptrdiff_t GLintptr;
+typedef unsigned long long GLuint64;
+
+#define GL_SHADING_LANGUAGE_VERSION         0x8B8C
+#define GL_BLUE                             0x1905
+#define GL_ALPHA                            0x1906
+#define GL_MIRRORED_REPEAT                  0x8370
+#define GL_QUERY_RESULT                     0x8866
+#define GL_QUERY_RESULT_AVAILABLE           0x8867
+#define GL_TIMESTAMP                        0x8E28
+typedef struct __GLsync *GLsync;
+
+    #define GL_ACTIVE_UNIFORMS                               0x8B86
+    #define GL_ARRAY_BUFFER                                  0x8892
+    #define GL_BACK                                          0x0405
+    #define GL_BLEND                                         0x0BE2
+    #define GL_CCW                                           0x0901
+    #define GL_CLAMP_TO_EDGE                                 0x812F
+    #define GL_CLIP_DISTANCE0                                0x3000
+    #define GL_CLIP_DISTANCE1                                0x3001
+    #define GL_COLOR_ATTACHMENT0                             0x8CE0
+    #define GL_COLOR_BUFFER_BIT                              0x00004000
+    #define GL_COMPILE_STATUS                                0x8B81
+    #define GL_CULL_FACE                                     0x0B44
+    #define GL_DEPTH_ATTACHMENT                              0x8D00
+    #define GL_DEPTH_BUFFER_BIT                              0x00000100
+    #define GL_DEPTH_COMPONENT                               0x1902
+    #define GL_DEPTH_COMPONENT16                             0x81A5
+    #define GL_DEPTH_COMPONENT24                             0x81A6
+    #define GL_DEPTH_COMPONENT32                             0x81A7
+    #define GL_DEPTH_TEST                                    0x0B71
+    #define GL_DST_COLOR                                     0x0306
+    #define GL_DYNAMIC_DRAW                                  0x88E8
+    #define GL_ELEMENT_ARRAY_BUFFER                          0x8893
+    #define GL_EXTENSIONS                                    0x1F03
+    #define GL_FALSE                                         0
+    #define GL_FILL                                          0x1B02
+    #define GL_FLOAT                                         0x1406
+    #define GL_FRAGMENT_SHADER                               0x8B30
+    #define GL_FRAMEBUFFER                                   0x8D40
+    #define GL_FRAMEBUFFER_COMPLETE                          0x8CD5
+    #define GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT             0x8CD6
+    #define GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT     0x8CD7
+    #define GL_FRAMEBUFFER_UNSUPPORTED                       0x8CDD
+    #define GL_FRONT_AND_BACK                                0x0408
+    #define GL_GREEN                                         0x1904
+    #define GL_INFO_LOG_LENGTH                               0x8B84
+    #define GL_LEQUAL                                        0x0203
+    #define GL_LINE                                          0x1B01
+    #define GL_LINEAR                                        0x2601
+    #define GL_LINEAR_MIPMAP_LINEAR                          0x2703
+    #define GL_LINK_STATUS                                   0x8B82
+    #define GL_MAP_COHERENT_BIT                              0x0080
+    #define GL_MAP_INVALIDATE_RANGE_BIT                      0x0004
+    #define GL_MAP_READ_BIT                                  0x0001
+    #define GL_MAP_PERSISTENT_BIT                            0x0040
+    #define GL_MAP_UNSYNCHRONIZED_BIT                        0x0020
+    #define GL_MAP_WRITE_BIT                                 0x0002
+    #define GL_NEAREST                                       0x2600
+    #define GL_NUM_EXTENSIONS                                0x821D
+    #define GL_NUM_PROGRAM_BINARY_FORMATS                    0x87FE
+    #define GL_ONE                                           1
+    #define GL_ONE_MINUS_SRC_ALPHA                           0x0303
+    #define GL_PACK_ALIGNMENT                                0x0D05
+    #define GL_PIXEL_PACK_BUFFER                             0x88EB
+    #define GL_PIXEL_UNPACK_BUFFER                           0x88EC
+    #define GL_PROGRAM_BINARY_LENGTH                         0x8741
+    #define GL_PROGRAM_BINARY_RETRIEVABLE_HINT               0x8257
+    #define GL_R32F                                          0x822E
+    #define GL_R8                                            0x8229
+    #define GL_RED                                           0x1903
+    #define GL_RENDERBUFFER                                  0x8D41
+    #define GL_RENDERER                                      0x1F01
+    #define GL_REPEAT                                        0x2901
+    #define GL_RG                                            0x8227
+    #define GL_RG8                                           0x822B
+    #define GL_RGB                                           0x1907
+    #define GL_RGB16F                                        0x881B
+    #define GL_RGB32F                                        0x8815
+    #define GL_RGB565                                        0x8D62
+    #define GL_RGB5_A1                                       0x8057
+    #define GL_RGB8                                          0x8051
+    #define GL_RGBA                                          0x1908
+    #define GL_RGBA32F                                       0x8814
+    #define GL_RGBA4                                         0x8056
+    #define GL_RGBA8                                         0x8058
+    #define GL_SCISSOR_TEST                                  0x0C11
+    #define GL_SRC_ALPHA                                     0x0302
+    #define GL_STATIC_DRAW                                   0x88E4
+    #define GL_STREAM_DRAW                                   0x88E0
+    #define GL_STREAM_READ                                   0x88E1
+    #define GL_SYNC_FLUSH_COMMANDS_BIT                       0x00000001
+    #define GL_SYNC_GPU_COMMANDS_COMPLETE                    0x9117
+    #define GL_TEXTURE0                                      0x84C0
+    #define GL_TEXTURE_2D                                    0x0DE1
+    #define GL_TEXTURE_CUBE_MAP                              0x8513
+    #define GL_TEXTURE_CUBE_MAP_POSITIVE_X                   0x8515
+    #define GL_TEXTURE_CUBE_MAP_SEAMLESS                     0x884F
+    #define GL_TEXTURE_MAG_FILTER                            0x2800
+    #define GL_TEXTURE_MIN_FILTER                            0x2801
+    #define GL_TEXTURE_SWIZZLE_RGBA                          0x8E46
+    #define GL_TEXTURE_WRAP_R                                0x8072
+    #define GL_TEXTURE_WRAP_S                                0x2802
+    #define GL_TEXTURE_WRAP_T                                0x2803
+    #define GL_TIMEOUT_EXPIRED                               0x911B
+    #define GL_TRIANGLES                                     0x0004
+    #define GL_TRIANGLE_FAN                                  0x0006
+    #define GL_TRIANGLE_STRIP                                0x0005
+    #define GL_TRUE                                          1
+    #define GL_UNPACK_ALIGNMENT                              0x0CF5
+    #define GL_UNSIGNED_BYTE                                 0x1401
+    #define GL_UNSIGNED_INT                                  0x1405
+    #define GL_UNSIGNED_SHORT                                0x1403
+    #define GL_UNSIGNED_SHORT_4_4_4_4                        0x8033
+    #define GL_UNSIGNED_SHORT_5_5_5_1                        0x8034
+    #define GL_UNSIGNED_SHORT_5_6_5                          0x8363
+    #define GL_VENDOR                                        0x1F00
+    #define GL_VERSION                                       0x1F02
+    #define GL_VERTEX_SHADER                                 0x8B31
+    #define GL_ZERO                                          0
+    #define GL_LINES                                         0x0001
+    #define GL_ALREADY_SIGNALED                              0x911A
+
+#define MAX_RECORD_ATTRIB_BINDINGS      64      // Maximum attribute locations bindings registered (glBindAttribLocation)
+#define MAX_RECORD_UNIFORM_NAMES       256      // Maximum uniform names registered (glGetUniformLocation)
+
+// Record backend texture info, required to answer texture queries
+typedef struct RecordTexture {
+    unsigned int id;            // Texture fake id
+    int width;                  // Texture width (level 0)
+    int height;                 // Texture height (level 0)
+    int format;                 // Texture internal format (OpenGL)
+    unsigned char *pixels;      // Texture RGBA 8bit pixels (software backend only)
+    int magFilter;              // Texture magnification filter (software backend only)
+    int wrapS;                  // Texture wrap mode, x-axis (software backend only)
+    int wrapT;                  // Texture wrap mode, y-axis (software backend only)
+    bool swizzled;              // Texture swizzle enabled (software backend only)
+    int swizzle[4];             // Texture swizzle (software backend only)
+} RecordTexture;
+
+static rlRecordCommand *recordCommands = NULL;  // Recorded commands list
+static int recordCommandsCounter = 0;           // Recorded commands counter
+static int recordCommandsCapacity = 0;          // Recorded commands list capacity
+static bool recordBatchDrawing = false;         // Batch draw calls are being processed (already recorded as flush)
+
+static unsigned int recordIdCounter = 0;        // Fake ids generator, shared by all objects types
+static unsigned int recordTextureUnits[32] = { 0 };    // Currently bound texture per texture unit
+static int recordActiveTexture = 0;             // Currently active texture unit
+static unsigned int recordFramebuffer = 0;      // Currently bound framebuffer
+static unsigned int recordProgram = 0;          // Currently used shader program
+static float recordClearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };  // Current clear color
+
+static RecordTexture *recordTextures = NULL;    // Loaded textures info
+static int recordTexturesCounter = 0;
+static int recordTexturesCapacity = 0;
+
+static struct { unsigned int program; unsigned int index; char name[32]; } recordAttribs[MAX_RECORD_ATTRIB_BINDINGS] = { 0 };
+static int recordAttribsCounter = 0;
+static char recordUniforms[MAX_RECORD_UNIFORM_NAMES][32] = { 0 };
+static int recordUniformsCounter = 0;
+
+// Register a new record command, returns a cleared command with current framebuffer
+static rlRecordCommand *RecordCommand(int type, unsigned int id)
+{
+#if defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: Software backend does not keep commands, a scratch command is returned
+    static rlRecordCommand scratch = { 0 };
+    memset(&scratch, 0, sizeof(rlRecordCommand));
+    scratch.type = type;
+    scratch.id = id;
+    scratch.framebuffer = recordFramebuffer;
+
+    return &scratch;
 #endif
 
-#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
-    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT     0x83F0
-#endif
-#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
-    #define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT    0x83F1
-#endif
-#ifndef GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
-    #define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT    0x83F2
-#endif
-#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
-    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT    0x83F3
-#endif
-#ifndef GL_ETC1_RGB8_OES
-    #define GL_ETC1_RGB8_OES                    0x8D64
-#endif
-#ifndef GL_COMPRESSED_RGB8_ETC2
-    #define GL_COMPRESSED_RGB8_ETC2             0x9274
-#endif
-#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
-    #define GL_COMPRESSED_RGBA8_ETC2_EAC        0x9278
-#endif
-#ifndef GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG
-    #define GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG  0x8C00
-#endif
-#ifndef GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG
-    #define GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG 0x8C02
-#endif
-#ifndef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
-    #define GL_COMPRESSED_RGBA_ASTC_4x4_KHR     0x93b0
-#endif
-#ifndef GL_COMPRESSED_RGBA_ASTC_8x8_KHR
-    #define GL_COMPRESSED_RGBA_ASTC_8x8_KHR     0x93b7
-#endif
+    if (recordCommandsCounter >= recordCommandsCapacity)
+    {
+        recordCommandsCapacity = (recordCommandsCapacity > 0)? 2*recordCommandsCapacity : 1024;
+        recordCommands = (rlRecordCommand *)RL_REALLOC(recordCommands, sizeof(rlRecordCommand)*recordCommandsCapacity);
+    }
 
-#ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
-    #define GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT   0x84FF
-#endif
+    rlRecordCommand *command = &recordCommands[recordCommandsCounter];
+    memset(command, 0, sizeof(rlRecordCommand));
+    command->type = type;
+    command->id = id;
+    command->framebuffer = recordFramebuffer;
+    recordCommandsCounter++;
 
-#ifndef GL_TEXTURE_MAX_ANISOTROPY_EXT
-    #define GL_TEXTURE_MAX_ANISOTROPY_EXT       0x84FE
-#endif
+    return command;
+}
 
-#if defined(GRAPHICS_API_OPENGL_11)
-    #define GL_UNSIGNED_SHORT_5_6_5             0x8363
-    #define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
-    #define GL_UNSIGNED_SHORT_4_4_4_4           0x8033
-#endif
+// Get texture info for a fake id, registered if required
+static RecordTexture *RecordGetTexture(unsigned int id)
+{
+    for (int i = 0; i < recordTexturesCounter; i++) if (recordTextures[i].id == id) return &recordTextures[i];
 
-#if defined(GRAPHICS_API_OPENGL_21)
-    #define GL_LUMINANCE                        0x1909
-    #define GL_LUMINANCE_ALPHA                  0x190A
-#endif
+    if (recordTexturesCounter >= recordTexturesCapacity)
+    {
+        recordTexturesCapacity = (recordTexturesCapacity > 0)? 2*recordTexturesCapacity : 64;
+        recordTextures = (RecordTexture *)RL_REALLOC(recordTextures, sizeof(RecordTexture)*recordTexturesCapacity);
+    }
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    #define glClearDepth                glClearDepthf
-    #define GL_READ_FRAMEBUFFER         GL_FRAMEBUFFER
-    #define GL_DRAW_FRAMEBUFFER         GL_FRAMEBUFFER
-#endif
+    RecordTexture *texture = &recordTextures[recordTexturesCounter];
+    memset(texture, 0, sizeof(RecordTexture));
+    texture->id = id;
+    texture->magFilter = GL_LINEAR;
+    texture->wrapS = GL_REPEAT;
+    texture->wrapT = GL_REPEAT;
+    recordTexturesCounter++;
 
-// Default vertex attribute names on shader to set location points
-#define DEFAULT_ATTRIB_POSITION_NAME    "vertexPosition"    // shader-location = 0
-#define DEFAULT_ATTRIB_TEXCOORD_NAME    "vertexTexCoord"    // shader-location = 1
-#define DEFAULT_ATTRIB_NORMAL_NAME      "vertexNormal"      // shader-location = 2
-#define DEFAULT_ATTRIB_COLOR_NAME       "vertexColor"       // shader-location = 3
-#define DEFAULT_ATTRIB_TANGENT_NAME     "vertexTangent"     // shader-location = 4
-#define DEFAULT_ATTRIB_TEXCOORD2_NAME   "vertexTexCoord2"   // shader-location = 5
+    return texture;
+}
 
-//----------------------------------------------------------------------------------
-// Types and Structures Definition
-//----------------------------------------------------------------------------------
+static void RecordGenIds(GLsizei n, GLuint *ids) { for (int i = 0; i < n; i++) ids[i] = ++recordIdCounter; }
 
-// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
-typedef struct DynamicBuffer {
-    int vCounter;               // vertex position counter to process (and draw) from full buffer
-    int tcCounter;              // vertex texcoord counter to process (and draw) from full buffer
-    int cCounter;               // vertex color counter to process (and draw) from full buffer
-    float *vertices;            // vertex position (XYZ - 3 components per vertex) (shader-location = 0)
-    float *texcoords;           // vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
-    unsigned char *colors;      // vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    unsigned int *indices;      // vertex indices (in case vertex data comes indexed) (6 indices per quad)
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned short *indices;    // vertex indices (in case vertex data comes indexed) (6 indices per quad)
-                                // NOTE: 6*2 byte = 12 byte, not alignment problem!
-#endif
-    unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
-} DynamicBuffer;
+// Get pixel size in bytes for an OpenGL pixel data format and type
+// NOTE: Only unsigned byte, float and packed 16bit types are supported, returns 0 for any other type
+static int RecordPixelSize(GLenum format, GLenum type)
+{
+    if ((type == GL_UNSIGNED_SHORT_5_6_5) || (type == GL_UNSIGNED_SHORT_5_5_5_1) || (type == GL_UNSIGNED_SHORT_4_4_4_4)) return 2;
 
-// Draw call type
-typedef struct DrawCall {
-    int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
-    int vertexCount;            // Number of vertex of the draw
-    int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
-    //unsigned int vaoId;         // Vertex array id to be used on the draw
-    //unsigned int shaderId;      // Shader id to be used on the draw
-    unsigned int textureId;     // Texture id to be used on the draw
-                                // TODO: Support additional texture units?
+    int channels = ((format == GL_RED) || (format == GL_ALPHA))? 1 : (format == GL_RG)? 2 : (format == GL_RGB)? 3 : 4;
 
-    //Matrix projection;        // Projection matrix for this draw
-    //Matrix modelview;         // Modelview matrix for this draw
-} DrawCall;
+    if (type == GL_UNSIGNED_BYTE) return channels;
+    else if (type == GL_FLOAT) return 4*channels;
+
+    return 0;
+}
 
+#if defined(GRAPHICS_API_SOFTWARE)
 //----------------------------------------------------------------------------------
-// Global Variables Definition
+// Software backend: rasterizer
+// NOTE: Batch draws (lines, triangles, quads) are rasterized on CPU into RGBA 8bit buffers
+// (default framebuffer and render textures color attachment), rows stored bottom-up as OpenGL does.
+// Primitives are binned into screen tiles and tiles are rasterized in parallel by worker threads,
+// primitives order is kept inside every tile (blending is order dependant).
+// Limitations: default shader shading only (custom shaders ignored), no depth test, no mipmaps,
+// primitives crossing the camera plane (clip w <= 0) are discarded
 //----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-static Matrix stack[MAX_MATRIX_STACK_SIZE] = { 0 };
-static int stackCounter = 0;
-
-static Matrix modelview = { 0 };
-static Matrix projection = { 0 };
-static Matrix *currentMatrix = NULL;
-static int currentMatrixMode = -1;
-static float currentDepth = -1.0f;
-
-// Default dynamic buffer for elements data
-// NOTE: A multi-buffering system is supported
-static DynamicBuffer vertexData[MAX_BATCH_BUFFERING] = { 0 };
-static int currentBuffer = 0;
+#define SW_TILE_SIZE                    64      // Tile size in pixels (square tiles)
+#define SW_MAX_THREADS                  16      // Maximum rasterization threads (including calling thread)
+#define SW_MIN_THREADED_PRIMITIVES      64      // Minimum primitives on a batch to rasterize it with worker threads
+#define SW_SUBPIXEL_BITS                 4      // Vertex positions snapping precision (1/16 pixel)
+#define SW_MAX_COORDINATE        (1 << 20)      // Maximum screen coordinate in pixels, primitives out of range are discarded
+#define MAX_SW_FRAMEBUFFERS             64      // Maximum framebuffers with color attachment registered
+
+// Fast division by 255 with rounding, exact for 0..65535 (t = value + 128)
+#define SW_DIV255(t)    (((t) + ((t) >> 8)) >> 8)
+
+// Software backend primitive (triangle), set up for rasterization
+typedef struct SwPrimitive {
+    long long x[3];             // Vertex screen positions, fixed point (SW_SUBPIXEL_BITS)
+    long long y[3];
+    float invArea;              // Inverse of doubled triangle area (fixed point units)
+    float q[3];                 // Vertex inverse clip w (perspective correct interpolation)
+    float u[3], v[3];           // Vertex texture coordinates, multiplied by q
+    float color[3][4];          // Vertex colors (0..255), multiplied by q
+    int minX, minY, maxX, maxY; // Pixels bounding box (inclusive), clipped to target, viewport and scissor
+    int blendMode;              // Blending mode
+    bool affine;                // Same inverse w on all vertex, no perspective division required
+    bool constantColor;         // Same color on all vertex (affine primitives only), no color interpolation required
+    bool flat;                  // Constant fragment color, filled by spans
+    unsigned char flatColor[4]; // Fragment color for flat primitives
+    RecordTexture *texture;     // Texture to sample (NULL for white)
+} SwPrimitive;
+
+// Software backend rasterization job, shared by worker threads
+typedef struct SwRasterJob {
+    RecordTexture *target;      // Target color buffer
+    SwPrimitive *primitives;    // Primitives set up for rasterization
+    int *tileOffsets;           // Tiles primitives list offsets (tilesCount + 1)
+    int *tileItems;             // Tiles primitives lists (primitive indices, in draw order)
+    int tilesX;                 // Tiles per row
+    int tilesCount;             // Tiles count
+    int nextTile;               // Next tile to rasterize
+#if !defined(_WIN32)
+    pthread_mutex_t mutex;      // Next tile access mutex
+#endif
+} SwRasterJob;
+
+static RecordTexture swScreen = { 0 };          // Default framebuffer color buffer
+static struct { unsigned int id; unsigned int texture; } swFramebuffers[MAX_SW_FRAMEBUFFERS] = { 0 };
+static int swFramebuffersCounter = 0;
+static int swViewport[4] = { 0 };               // Current viewport (x, y, width, height)
+
+static SwPrimitive *swPrimitives = NULL;        // Primitives buffer, reused between batches
+static int swPrimitivesCapacity = 0;
+static int *swTileOffsets = NULL;               // Tiles primitives lists offsets buffer
+static int swTileOffsetsCapacity = 0;
+static int *swTileItems = NULL;                 // Tiles primitives lists buffer
+static int swTileItemsCapacity = 0;
+static int swThreadsCount = 0;                  // Rasterization threads, detected on first batch
+
+// Find texture info for a fake id, NULL if not registered
+static RecordTexture *SwFindTexture(unsigned int id)
+{
+    for (int i = 0; i < recordTexturesCounter; i++) if (recordTextures[i].id == id) return &recordTextures[i];
 
-// Transform matrix to be used with rlTranslate, rlRotate, rlScale
-static Matrix transformMatrix = { 0 };
-static bool useTransformMatrix = false;
+    return NULL;
+}
 
-// Default buffers draw calls
-static DrawCall *draws = NULL;
-static int drawsCounter = 0;
+// Get current framebuffer color buffer
+static RecordTexture *SwGetTarget(void)
+{
+    if (recordFramebuffer == 0) return &swScreen;
 
-// Default texture (1px white) useful for plain color polys (required by shader)
-static unsigned int defaultTextureId = 0;
+    for (int i = 0; i < swFramebuffersCounter; i++)
+    {
+        if (swFramebuffers[i].id == recordFramebuffer) return SwFindTexture(swFramebuffers[i].texture);
+    }
 
-// Default shaders
-static unsigned int defaultVShaderId = 0;   // Default vertex shader id (used by default shader program)
-static unsigned int defaultFShaderId = 0;   // Default fragment shader Id (used by default shader program)
+    return NULL;
+}
 
-static Shader defaultShader = { 0 };        // Basic shader, support vertex color and diffuse texture
-static Shader currentShader = { 0 };        // Shader to be used on rendering (by default, defaultShader)
+// Resize default framebuffer color buffer (cleared)
+static void SwResizeScreen(int width, int height)
+{
+    RL_FREE(swScreen.pixels);
+    swScreen.width = width;
+    swScreen.height = height;
+    swScreen.format = GL_RGBA8;
+    swScreen.pixels = (unsigned char *)RL_CALLOC(width*height*4, 1);
+}
 
-// Extension supported flag: VAO
-static bool vaoSupported = false;           // VAO support (OpenGL ES2 could not support VAO extension)
+// Convert pixel data (OpenGL format and type) into texture RGBA 8bit pixels region
+static void SwConvertPixels(RecordTexture *texture, int offsetX, int offsetY, int width, int height, GLenum format, GLenum type, const void *data)
+{
+    int channels = 4;
 
-// Extension supported flag: Compressed textures
-static bool texCompDXTSupported = false;    // DDS texture compression support
-static bool texCompETC1Supported = false;   // ETC1 texture compression support
-static bool texCompETC2Supported = false;   // ETC2/EAC texture compression support
-static bool texCompPVRTSupported = false;   // PVR texture compression support
-static bool texCompASTCSupported = false;   // ASTC texture compression support
+    switch (format)
+    {
+        case GL_RED: channels = 1; break;
+        case GL_RG: channels = 2; break;
+        case GL_RGB: channels = 3; break;
+        default: break;
+    }
 
-// Extension supported flag: Textures format
-static bool texNPOTSupported = false;       // NPOT textures full support
-static bool texFloatSupported = false;      // float textures support (32 bit per channel)
-static bool texDepthSupported = false;      // Depth textures supported
-static int maxDepthBits = 16;               // Maximum bits for depth component
+    for (int y = 0; y < height; y++)
+    {
+        if ((offsetY + y < 0) || (offsetY + y >= texture->height)) continue;
 
-// Extension supported flag: Clamp mirror wrap mode
-static bool texMirrorClampSupported = false;        // Clamp mirror wrap mode supported
+        for (int x = 0; x < width; x++)
+        {
+            if ((offsetX + x < 0) || (offsetX + x >= texture->width)) continue;
 
-// Extension supported flag: Anisotropic filtering
-static bool texAnisotropicFilterSupported = false;  // Anisotropic texture filtering support
-static float maxAnisotropicLevel = 0.0f;            // Maximum anisotropy level supported (minimum is 2.0f)
+            unsigned char *pixel = texture->pixels + ((offsetY + y)*texture->width + offsetX + x)*4;
+            int index = y*width + x;
+            unsigned char rgba[4] = { 0, 0, 0, 255 };
 
-static bool debugMarkerSupported = false;   // Debug marker support
+            if (type == GL_UNSIGNED_BYTE)
+            {
+                for (int c = 0; c < channels; c++) rgba[c] = ((const unsigned char *)data)[index*channels + c];
+            }
+            else if (type == GL_FLOAT)
+            {
+                for (int c = 0; c < channels; c++)
+                {
+                    float value = ((const float *)data)[index*channels + c];
+                    rgba[c] = (value <= 0.0f)? 0 : (value >= 1.0f)? 255 : (unsigned char)(value*255.0f + 0.5f);
+                }
+            }
+            else if (type == GL_UNSIGNED_SHORT_5_6_5)
+            {
+                unsigned short value = ((const unsigned short *)data)[index];
+                rgba[0] = (unsigned char)(((value >> 11) & 0x1f)*255/31);
+                rgba[1] = (unsigned char)(((value >> 5) & 0x3f)*255/63);
+                rgba[2] = (unsigned char)((value & 0x1f)*255/31);
+            }
+            else if (type == GL_UNSIGNED_SHORT_5_5_5_1)
+            {
+                unsigned short value = ((const unsigned short *)data)[index];
+                rgba[0] = (unsigned char)(((value >> 11) & 0x1f)*255/31);
+                rgba[1] = (unsigned char)(((value >> 6) & 0x1f)*255/31);
+                rgba[2] = (unsigned char)(((value >> 1) & 0x1f)*255/31);
+                rgba[3] = (value & 0x1)? 255 : 0;
+            }
+            else if (type == GL_UNSIGNED_SHORT_4_4_4_4)
+            {
+                unsigned short value = ((const unsigned short *)data)[index];
+                rgba[0] = (unsigned char)(((value >> 12) & 0xf)*17);
+                rgba[1] = (unsigned char)(((value >> 8) & 0xf)*17);
+                rgba[2] = (unsigned char)(((value >> 4) & 0xf)*17);
+                rgba[3] = (unsigned char)((value & 0xf)*17);
+            }
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-// NOTE: VAO functionality is exposed through extensions (OES)
-static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays;
-static PFNGLBINDVERTEXARRAYOESPROC glBindVertexArray;
-static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays;
-//static PFNGLISVERTEXARRAYOESPROC glIsVertexArray;   // NOTE: Fails in WebGL, omitted
-#endif
+            memcpy(pixel, rgba, 4);
+        }
+    }
+}
 
-#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+// Convert texture RGBA 8bit pixels into pixel data (OpenGL format and type, same types supported than SwConvertPixels())
+static void SwReadPixels(RecordTexture *texture, int offsetX, int offsetY, int width, int height, GLenum format, GLenum type, void *data)
+{
+    int channels = ((format == GL_RED) || (format == GL_ALPHA))? 1 : (format == GL_RG)? 2 : (format == GL_RGB)? 3 : 4;
+    int size = RecordPixelSize(format, type);
 
-static int blendMode = 0;                   // Track current blending mode
+    // NOTE: Unsupported types are rejected before writing any data, pixel size is unknown
+    if (size == 0)
+    {
+        TraceLog(LOG_WARNING, "Software backend: pixels data type not supported for reading");
+        return;
+    }
 
-// Default framebuffer size
-static int framebufferWidth = 0;            // Default framebuffer width
-static int framebufferHeight = 0;           // Default framebuffer height
+    memset(data, 0, width*height*size);
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Declaration
-//----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-static unsigned int CompileShader(const char *shaderStr, int type);     // Compile custom shader and return shader id
-static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId);  // Load custom shader program
+    if ((texture == NULL) || (texture->pixels == NULL))
+    {
+        TraceLog(LOG_WARNING, "Software backend: pixels data could not be read");
+        return;
+    }
 
-static Shader LoadShaderDefault(void);      // Load default shader (just vertex positioning and texture coloring)
-static void SetShaderDefaultLocations(Shader *shader); // Bind default shader locations (attributes and uniforms)
-static void UnloadShaderDefault(void);      // Unload default shader
+    for (int y = 0; y < height; y++)
+    {
+        if ((offsetY + y < 0) || (offsetY + y >= texture->height)) continue;
 
-static void LoadBuffersDefault(void);       // Load default internal buffers
-static void UpdateBuffersDefault(void);     // Update default internal buffers (VAOs/VBOs) with vertex data
-static void DrawBuffersDefault(void);       // Draw default internal buffers vertex data
-static void UnloadBuffersDefault(void);     // Unload default internal buffers vertex data from CPU and GPU
+        for (int x = 0; x < width; x++)
+        {
+            if ((offsetX + x < 0) || (offsetX + x >= texture->width)) continue;
 
-static void GenDrawCube(void);              // Generate and draw cube
-static void GenDrawQuad(void);              // Generate and draw quad
+            const unsigned char *pixel = texture->pixels + ((offsetY + y)*texture->width + offsetX + x)*4;
+            unsigned char *output = (unsigned char *)data + (y*width + x)*size;
 
-#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+            if (type == GL_UNSIGNED_BYTE)
+            {
+                if (format == GL_ALPHA) output[0] = pixel[3];
+                else memcpy(output, pixel, channels);
+            }
+            else if (type == GL_FLOAT)
+            {
+                float values[4] = { 0 };
+                for (int c = 0; c < channels; c++) values[c] = (float)pixel[(format == GL_ALPHA)? 3 : c]/255.0f;
+                memcpy(output, values, size);
+            }
+            else
+            {
+                unsigned short value = 0;
 
-#if defined(GRAPHICS_API_OPENGL_11)
-static int GenerateMipmaps(unsigned char *data, int baseWidth, int baseHeight);
-static Color *GenNextMipmap(Color *srcData, int srcWidth, int srcHeight);
-#endif
+                if (type == GL_UNSIGNED_SHORT_5_6_5) value = (unsigned short)(((pixel[0] >> 3) << 11) | ((pixel[1] >> 2) << 5) | (pixel[2] >> 3));
+                else if (type == GL_UNSIGNED_SHORT_5_5_5_1) value = (unsigned short)(((pixel[0] >> 3) << 11) | ((pixel[1] >> 3) << 6) | ((pixel[2] >> 3) << 1) | (pixel[3] >> 7));
+                else if (type == GL_UNSIGNED_SHORT_4_4_4_4) value = (unsigned short)(((pixel[0] >> 4) << 12) | ((pixel[1] >> 4) << 8) | ((pixel[2] >> 4) << 4) | (pixel[3] >> 4));
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Matrix operations
-//----------------------------------------------------------------------------------
+                memcpy(output, &value, 2);
+            }
+        }
+    }
+}
 
-#if defined(GRAPHICS_API_OPENGL_11)
+// Floor to integer (faster than floorf() when not inlined)
+static int SwFloor(float value)
+{
+    int result = (int)value;
+    return (value < (float)result)? result - 1 : result;
+}
 
-// Fallback to OpenGL 1.1 function calls
-//---------------------------------------
-void rlMatrixMode(int mode)
+// Wrap texel coordinate
+static int SwWrap(int coord, int size, int wrap)
 {
-    switch (mode)
+    if ((coord >= 0) && (coord < size)) return coord;
+
+    if (wrap == GL_REPEAT)
     {
-        case RL_PROJECTION: glMatrixMode(GL_PROJECTION); break;
-        case RL_MODELVIEW: glMatrixMode(GL_MODELVIEW); break;
-        case RL_TEXTURE: glMatrixMode(GL_TEXTURE); break;
-        default: break;
+        coord %= size;
+        if (coord < 0) coord += size;
     }
-}
+    else if (wrap == GL_MIRRORED_REPEAT)
+    {
+        coord %= 2*size;
+        if (coord < 0) coord += 2*size;
+        if (coord >= size) coord = 2*size - 1 - coord;
+    }
+    else coord = (coord < 0)? 0 : (coord >= size)? size - 1 : coord;
 
-void rlFrustum(double left, double right, double bottom, double top, double znear, double zfar)
-{
-    glFrustum(left, right, bottom, top, znear, zfar);
+    return coord;
 }
 
-void rlOrtho(double left, double right, double bottom, double top, double znear, double zfar)
+// Get texel color, applying texture swizzle
+static void SwTexel(const RecordTexture *texture, int x, int y, float *color)
 {
-    glOrtho(left, right, bottom, top, znear, zfar);
-}
-
-void rlPushMatrix(void) { glPushMatrix(); }
-void rlPopMatrix(void) { glPopMatrix(); }
-void rlLoadIdentity(void) { glLoadIdentity(); }
-void rlTranslatef(float x, float y, float z) { glTranslatef(x, y, z); }
-void rlRotatef(float angleDeg, float x, float y, float z) { glRotatef(angleDeg, x, y, z); }
-void rlScalef(float x, float y, float z) { glScalef(x, y, z); }
-void rlMultMatrixf(float *matf) { glMultMatrixf(matf); }
+    const unsigned char *texel = texture->pixels + (y*texture->width + x)*4;
 
-#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (texture->swizzled)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            switch (texture->swizzle[c])
+            {
+                case GL_RED: color[c] = texel[0]; break;
+                case GL_GREEN: color[c] = texel[1]; break;
+                case GL_BLUE: color[c] = texel[2]; break;
+                case GL_ALPHA: color[c] = texel[3]; break;
+                case GL_ONE: color[c] = 255.0f; break;
+                default: color[c] = 0.0f; break;
+            }
+        }
+    }
+    else for (int c = 0; c < 4; c++) color[c] = texel[c];
+}
 
-// Choose the current matrix to be transformed
-void rlMatrixMode(int mode)
+// Sample texture at texture coordinates (nearest or bilinear filtering, no mipmaps)
+static void SwSample(const RecordTexture *texture, float u, float v, float *color)
 {
-    if (mode == RL_PROJECTION) currentMatrix = &projection;
-    else if (mode == RL_MODELVIEW) currentMatrix = &modelview;
-    //else if (mode == RL_TEXTURE) // Not supported
+    if (texture->magFilter == GL_LINEAR)
+    {
+        float x = u*texture->width - 0.5f;
+        float y = v*texture->height - 0.5f;
+        int fx = SwFloor(x);
+        int fy = SwFloor(y);
+        float tx = x - fx;
+        float ty = y - fy;
+
+        int x0 = SwWrap(fx, texture->width, texture->wrapS);
+        int x1 = SwWrap(fx + 1, texture->width, texture->wrapS);
+        int y0 = SwWrap(fy, texture->height, texture->wrapT);
+        int y1 = SwWrap(fy + 1, texture->height, texture->wrapT);
+
+        float c00[4], c10[4], c01[4], c11[4];
+        SwTexel(texture, x0, y0, c00);
+        SwTexel(texture, x1, y0, c10);
+        SwTexel(texture, x0, y1, c01);
+        SwTexel(texture, x1, y1, c11);
+
+        for (int c = 0; c < 4; c++)
+        {
+            float top = c00[c] + (c10[c] - c00[c])*tx;
+            float bottom = c01[c] + (c11[c] - c01[c])*tx;
+            color[c] = top + (bottom - top)*ty;
+        }
+    }
+    else
+    {
+        int x = SwWrap(SwFloor(u*texture->width), texture->width, texture->wrapS);
+        int y = SwWrap(SwFloor(v*texture->height), texture->height, texture->wrapT);
 
-    currentMatrixMode = mode;
+        SwTexel(texture, x, y, color);
+    }
 }
 
-// Push the current matrix into stack
-void rlPushMatrix(void)
+// Blend fragment color into pixel, blending modes match BeginBlendMode() OpenGL blend functions
+static void SwBlendPixel(unsigned char *pixel, const unsigned char *color, int blendMode)
 {
-    if (stackCounter >= MAX_MATRIX_STACK_SIZE) TraceLog(LOG_ERROR, "Matrix stack overflow");
+    int alpha = color[3];
 
-    if (currentMatrixMode == RL_MODELVIEW)
+    switch (blendMode)
     {
-        useTransformMatrix = true;
-        currentMatrix = &transformMatrix;
+        case BLEND_ADDITIVE:        // glBlendFunc(GL_SRC_ALPHA, GL_ONE)
+        {
+            for (int c = 0; c < 4; c++)
+            {
+                int value = SW_DIV255(color[c]*alpha + 128) + pixel[c];
+                pixel[c] = (value > 255)? 255 : value;
+            }
+        } break;
+        case BLEND_MULTIPLIED:      // glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA)
+        {
+            for (int c = 0; c < 4; c++)
+            {
+                int value = (color[c]*pixel[c] + pixel[c]*(255 - alpha) + 127)/255;
+                pixel[c] = (value > 255)? 255 : value;
+            }
+        } break;
+        default:                    // glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA)
+        {
+            for (int c = 0; c < 4; c++) pixel[c] = SW_DIV255(color[c]*alpha + pixel[c]*(255 - alpha) + 128);
+        } break;
     }
-
-    stack[stackCounter] = *currentMatrix;
-    stackCounter++;
 }
 
-// Pop lattest inserted matrix from stack
-void rlPopMatrix(void)
+// Fill pixels span with constant color
+// NOTE: Opaque and alpha blended spans are filled 4 pixels at once with SSE2, results match SwBlendPixel()
+static void SwFillSpan(unsigned char *pixels, int count, const unsigned char *color, int blendMode)
 {
-    if (stackCounter > 0)
+    int i = 0;
+
+    if ((blendMode == BLEND_ALPHA) && (color[3] == 255))
     {
-        Matrix mat = stack[stackCounter - 1];
-        *currentMatrix = mat;
-        stackCounter--;
+        unsigned int value = 0;
+        memcpy(&value, color, 4);
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        __m128i packed = _mm_set1_epi32((int)value);
+        for (; i + 4 <= count; i += 4) _mm_storeu_si128((__m128i *)(pixels + i*4), packed);
+#endif
+        for (; i < count; i++) memcpy(pixels + i*4, &value, 4);
     }
-
-    if ((stackCounter == 0) && (currentMatrixMode == RL_MODELVIEW))
+    else if (blendMode == BLEND_ALPHA)
     {
-        currentMatrix = &modelview;
-        useTransformMatrix = false;
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        int alpha = color[3];
+        __m128i zero = _mm_setzero_si128();
+        __m128i source = _mm_set_epi16(color[3]*alpha + 128, color[2]*alpha + 128, color[1]*alpha + 128, color[0]*alpha + 128,
+                                       color[3]*alpha + 128, color[2]*alpha + 128, color[1]*alpha + 128, color[0]*alpha + 128);
+        __m128i inverse = _mm_set1_epi16((short)(255 - alpha));
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i dest = _mm_loadu_si128((const __m128i *)(pixels + i*4));
+            __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dest, zero), inverse), source);
+            __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dest, zero), inverse), source);
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+            _mm_storeu_si128((__m128i *)(pixels + i*4), _mm_packus_epi16(lo, hi));
+        }
+#endif
+        for (; i < count; i++) SwBlendPixel(pixels + i*4, color, blendMode);
     }
+    else for (; i < count; i++) SwBlendPixel(pixels + i*4, color, blendMode);
 }
 
-// Reset current matrix to identity matrix
-void rlLoadIdentity(void)
+// Rasterize primitive pixels inside a tile
+static void SwRasterizePrimitive(const SwPrimitive *prim, RecordTexture *target, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY)
 {
-    *currentMatrix = MatrixIdentity();
-}
+    int minX = (prim->minX > tileMinX)? prim->minX : tileMinX;
+    int minY = (prim->minY > tileMinY)? prim->minY : tileMinY;
+    int maxX = (prim->maxX < tileMaxX)? prim->maxX : tileMaxX;
+    int maxY = (prim->maxY < tileMaxY)? prim->maxY : tileMaxY;
 
-// Multiply the current matrix by a translation matrix
-void rlTranslatef(float x, float y, float z)
-{
-    Matrix matTranslation = MatrixTranslate(x, y, z);
+    if ((minX > maxX) || (minY > maxY)) return;
 
-    // NOTE: We transpose matrix with multiplication order
-    *currentMatrix = MatrixMultiply(matTranslation, *currentMatrix);
-}
+    const long long one = 1 << SW_SUBPIXEL_BITS;
+    const long long half = one/2;
 
-// Multiply the current matrix by a rotation matrix
-void rlRotatef(float angleDeg, float x, float y, float z)
-{
-    Matrix matRotation = MatrixIdentity();
+    // Edge functions: edge i is opposite to vertex i, positive inside (counter-clockwise triangles)
+    long long stepX[3], stepY[3], origin[3];
+    bool owned[3];
 
-    Vector3 axis = (Vector3){ x, y, z };
-    matRotation = MatrixRotate(Vector3Normalize(axis), angleDeg*DEG2RAD);
+    for (int i = 0; i < 3; i++)
+    {
+        int a = (i + 1)%3;
+        int b = (i + 2)%3;
+        long long dx = prim->x[b] - prim->x[a];
+        long long dy = prim->y[b] - prim->y[a];
 
-    // NOTE: We transpose matrix with multiplication order
-    *currentMatrix = MatrixMultiply(matRotation, *currentMatrix);
-}
+        stepX[i] = -dy*one;
+        stepY[i] = dx*one;
+        origin[i] = dx*(minY*one + half - prim->y[a]) - dy*(minX*one + half - prim->x[a]);
 
-// Multiply the current matrix by a scaling matrix
-void rlScalef(float x, float y, float z)
-{
-    Matrix matScale = MatrixScale(x, y, z);
+        // Fill rule: pixels centers exactly over an edge belong to one triangle only
+        owned[i] = (dy < 0) || ((dy == 0) && (dx > 0));
+    }
 
-    // NOTE: We transpose matrix with multiplication order
-    *currentMatrix = MatrixMultiply(matScale, *currentMatrix);
-}
+    // Attributes increments per pixel on x-axis
+    float stepW[3];
+    for (int i = 0; i < 3; i++) stepW[i] = (float)stepX[i]*prim->invArea;
 
-// Multiply the current matrix by another matrix
-void rlMultMatrixf(float *matf)
-{
-    // Matrix creation from array
-    Matrix mat = { matf[0], matf[4], matf[8], matf[12],
-                   matf[1], matf[5], matf[9], matf[13],
-                   matf[2], matf[6], matf[10], matf[14],
-                   matf[3], matf[7], matf[11], matf[15] };
+    float stepQ = stepW[0]*prim->q[0] + stepW[1]*prim->q[1] + stepW[2]*prim->q[2];
+    float stepU = stepW[0]*prim->u[0] + stepW[1]*prim->u[1] + stepW[2]*prim->u[2];
+    float stepV = stepW[0]*prim->v[0] + stepW[1]*prim->v[1] + stepW[2]*prim->v[2];
+    float stepColor[4];
+    for (int c = 0; c < 4; c++) stepColor[c] = stepW[0]*prim->color[0][c] + stepW[1]*prim->color[1][c] + stepW[2]*prim->color[2][c];
 
-    *currentMatrix = MatrixMultiply(*currentMatrix, mat);
-}
+    for (int y = minY; y <= maxY; y++)
+    {
+        // Row span from edge functions, triangles are convex so inside pixels are contiguous
+        // NOTE: Edge i value at pixel x is origin[i] + stepX[i]*(x - minX), pixel inside if value > 0 (>= 0 if owned)
+        int spanStart = minX;
+        int spanEnd = maxX;
 
-// Multiply the current matrix by a perspective matrix generated by parameters
-void rlFrustum(double left, double right, double bottom, double top, double znear, double zfar)
-{
-    Matrix matPerps = MatrixFrustum(left, right, bottom, top, znear, zfar);
+        for (int i = 0; i < 3; i++)
+        {
+            long long value = origin[i] + (owned[i]? 1 : 0);    // Inside if value + stepX*k > 0
 
-    *currentMatrix = MatrixMultiply(*currentMatrix, matPerps);
-}
+            if (stepX[i] == 0)
+            {
+                if (value <= 0) spanEnd = minX - 1;
+            }
+            else if (stepX[i] > 0)
+            {
+                // First inside pixel: k > -value/stepX
+                long long k = (-value)/stepX[i];
+                if (((-value)%stepX[i] != 0) && (-value < 0)) k--;
+                k++;
 
-// Multiply the current matrix by an orthographic matrix generated by parameters
-void rlOrtho(double left, double right, double bottom, double top, double znear, double zfar)
-{
-    Matrix matOrtho = MatrixOrtho(left, right, bottom, top, znear, zfar);
+                if (k > maxX - minX + 1) k = maxX - minX + 1;
+                if (minX + (int)k > spanStart) spanStart = minX + (int)k;
+            }
+            else
+            {
+                // Last inside pixel: k < value/-stepX
+                long long k = value/(-stepX[i]);
+                if ((value%(-stepX[i]) != 0) && (value > 0)) k++;
+                k--;
 
-    *currentMatrix = MatrixMultiply(*currentMatrix, matOrtho);
-}
+                if (k < -1) k = -1;
+                if (minX + (int)k < spanEnd) spanEnd = minX + (int)k;
+            }
+        }
 
-#endif
+        if (spanStart > spanEnd) spanStart = -1;
 
-// Set the viewport area (transformation from normalized device coordinates to window coordinates)
-// NOTE: Updates global variables: framebufferWidth, framebufferHeight
-void rlViewport(int x, int y, int width, int height)
-{
-    glViewport(x, y, width, height);
-}
+        if (spanStart >= 0)
+        {
+            unsigned char *pixels = target->pixels + (y*target->width + spanStart)*4;
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Vertex level operations
-//----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_11)
+            if (prim->flat) SwFillSpan(pixels, spanEnd - spanStart + 1, prim->flatColor, prim->blendMode);
+            else
+            {
+                // Attributes at span start (barycentric weights from edge functions), stepped per pixel
+                float w[3];
+                for (int i = 0; i < 3; i++) w[i] = (float)(origin[i] + stepX[i]*(spanStart - minX))*prim->invArea;
 
-// Fallback to OpenGL 1.1 function calls
-//---------------------------------------
-void rlBegin(int mode)
-{
-    switch (mode)
-    {
-        case RL_LINES: glBegin(GL_LINES); break;
-        case RL_TRIANGLES: glBegin(GL_TRIANGLES); break;
-        case RL_QUADS: glBegin(GL_QUADS); break;
-        default: break;
-    }
-}
+                float q = w[0]*prim->q[0] + w[1]*prim->q[1] + w[2]*prim->q[2];
+                float u = w[0]*prim->u[0] + w[1]*prim->u[1] + w[2]*prim->u[2];
+                float v = w[0]*prim->v[0] + w[1]*prim->v[1] + w[2]*prim->v[2];
+                float color[4];
+                for (int c = 0; c < 4; c++) color[c] = w[0]*prim->color[0][c] + w[1]*prim->color[1][c] + w[2]*prim->color[2][c];
 
-void rlEnd() { glEnd(); }
-void rlVertex2i(int x, int y) { glVertex2i(x, y); }
-void rlVertex2f(float x, float y) { glVertex2f(x, y); }
-void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
-void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
-void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
-void rlColor4ub(byte r, byte g, byte b, byte a) { glColor4ub(r, g, b, a); }
-void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
-void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+                for (int x = spanStart; x <= spanEnd; x++, pixels += 4)
+                {
+                    float invq = prim->affine? 1.0f : 1.0f/q;
+                    float fragColor[4];
 
-#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+                    if (prim->constantColor) for (int c = 0; c < 4; c++) fragColor[c] = prim->color[0][c];
+                    else for (int c = 0; c < 4; c++) fragColor[c] = color[c]*invq;
 
-// Initialize drawing mode (how to organize vertex)
-void rlBegin(int mode)
-{
-    // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
-    // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
-    if (draws[drawsCounter - 1].mode != mode)
-    {
-        if (draws[drawsCounter - 1].vertexCount > 0)
-        {
-            // Make sure current draws[i].vertexCount is aligned a multiple of 4,
-            // that way, following QUADS drawing will keep aligned with index processing
-            // It implies adding some extra alignment vertex at the end of the draw,
-            // those vertex are not processed but they are considered as an additional offset
-            // for the next set of vertex to be drawn
-            if (draws[drawsCounter - 1].mode == RL_LINES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? draws[drawsCounter - 1].vertexCount : draws[drawsCounter - 1].vertexCount%4);
-            else if (draws[drawsCounter - 1].mode == RL_TRIANGLES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? 1 : (4 - (draws[drawsCounter - 1].vertexCount%4)));
+                    if (prim->texture != NULL)
+                    {
+                        float texel[4];
+                        SwSample(prim->texture, u*invq, v*invq, texel);
 
-            else draws[drawsCounter - 1].vertexAlignment = 0;
+                        for (int c = 0; c < 4; c++) fragColor[c] *= texel[c]*(1.0f/255.0f);
+                    }
 
-            if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDraw();
-            else
-            {
-                vertexData[currentBuffer].vCounter += draws[drawsCounter - 1].vertexAlignment;
-                vertexData[currentBuffer].cCounter += draws[drawsCounter - 1].vertexAlignment;
-                vertexData[currentBuffer].tcCounter += draws[drawsCounter - 1].vertexAlignment;
+                    unsigned char fragment[4];
+                    for (int c = 0; c < 4; c++) fragment[c] = (fragColor[c] <= 0.0f)? 0 : (fragColor[c] >= 255.0f)? 255 : (unsigned char)(fragColor[c] + 0.5f);
+
+                    SwBlendPixel(pixels, fragment, prim->blendMode);
 
-                drawsCounter++;
+                    q += stepQ;
+                    u += stepU;
+                    v += stepV;
+                    for (int c = 0; c < 4; c++) color[c] += stepColor[c];
+                }
             }
         }
 
-        if (drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
-
-        draws[drawsCounter - 1].mode = mode;
-        draws[drawsCounter - 1].vertexCount = 0;
-        draws[drawsCounter - 1].textureId = defaultTextureId;
+        for (int i = 0; i < 3; i++) origin[i] += stepY[i];
     }
 }
 
-// Finish vertex providing
-void rlEnd(void)
+// Rasterize job tiles until no tile left (worker threads and calling thread)
+static void *SwRasterizeTiles(void *arg)
 {
-    // Make sure vertexCount is the same for vertices, texcoords, colors and normals
-    // NOTE: In OpenGL 1.1, one glColor call can be made for all the subsequent glVertex calls
+    SwRasterJob *job = (SwRasterJob *)arg;
 
-    // Make sure colors count match vertex count
-    if (vertexData[currentBuffer].vCounter != vertexData[currentBuffer].cCounter)
+    while (true)
     {
-        int addColors = vertexData[currentBuffer].vCounter - vertexData[currentBuffer].cCounter;
+#if !defined(_WIN32)
+        pthread_mutex_lock(&job->mutex);
+#endif
+        int tile = job->nextTile++;
+#if !defined(_WIN32)
+        pthread_mutex_unlock(&job->mutex);
+#endif
+        if (tile >= job->tilesCount) break;
+
+        int tileMinX = (tile%job->tilesX)*SW_TILE_SIZE;
+        int tileMinY = (tile/job->tilesX)*SW_TILE_SIZE;
 
-        for (int i = 0; i < addColors; i++)
+        for (int i = job->tileOffsets[tile]; i < job->tileOffsets[tile + 1]; i++)
         {
-            vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 4];
-            vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 1] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 3];
-            vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 2] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 2];
-            vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 3] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 1];
-            vertexData[currentBuffer].cCounter++;
+            SwRasterizePrimitive(&job->primitives[job->tileItems[i]], job->target, tileMinX, tileMinY, tileMinX + SW_TILE_SIZE - 1, tileMinY + SW_TILE_SIZE - 1);
         }
     }
 
-    // Make sure texcoords count match vertex count
-    if (vertexData[currentBuffer].vCounter != vertexData[currentBuffer].tcCounter)
+    return NULL;
+}
+
+// Set up a triangle for rasterization, returns false if discarded (culled or degenerated)
+static bool SwSetupTriangle(SwPrimitive *prim, const float clip[3][4], const float *texcoords[3], const unsigned char *colors[3], int clipRec[4])
+{
+    float scale = (float)(1 << SW_SUBPIXEL_BITS);
+    float screen[3][2];
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (clip[i][3] <= 1e-6f) return false;
+
+        prim->q[i] = 1.0f/clip[i][3];
+        screen[i][0] = swViewport[0] + (clip[i][0]*prim->q[i] + 1.0f)*0.5f*swViewport[2];
+        screen[i][1] = swViewport[1] + (clip[i][1]*prim->q[i] + 1.0f)*0.5f*swViewport[3];
+
+        if ((fabsf(screen[i][0]) > SW_MAX_COORDINATE) || (fabsf(screen[i][1]) > SW_MAX_COORDINATE)) return false;
+
+        prim->x[i] = (long long)floorf(screen[i][0]*scale + 0.5f);
+        prim->y[i] = (long long)floorf(screen[i][1]*scale + 0.5f);
+    }
+
+    long long area = (prim->x[1] - prim->x[0])*(prim->y[2] - prim->y[0]) - (prim->y[1] - prim->y[0])*(prim->x[2] - prim->x[0]);
+    if (area == 0) return false;
+
+    // Vertex order: counter-clockwise triangles (no face culling)
+    int order[3] = { 0, 1, 2 };
+    if (area < 0)
+    {
+        long long temp = prim->x[1]; prim->x[1] = prim->x[2]; prim->x[2] = temp;
+        temp = prim->y[1]; prim->y[1] = prim->y[2]; prim->y[2] = temp;
+        float tempq = prim->q[1]; prim->q[1] = prim->q[2]; prim->q[2] = tempq;
+        order[1] = 2;
+        order[2] = 1;
+        area = -area;
+    }
+
+    prim->invArea = 1.0f/(float)area;
+
+    for (int i = 0; i < 3; i++)
     {
-        int addTexCoords = vertexData[currentBuffer].vCounter - vertexData[currentBuffer].tcCounter;
+        prim->u[i] = texcoords[order[i]][0]*prim->q[i];
+        prim->v[i] = texcoords[order[i]][1]*prim->q[i];
+        for (int c = 0; c < 4; c++) prim->color[i][c] = colors[order[i]][c]*prim->q[i];
+    }
 
-        for (int i = 0; i < addTexCoords; i++)
+    prim->affine = (prim->q[0] == prim->q[1]) && (prim->q[0] == prim->q[2]);
+    if (prim->affine)
+    {
+        for (int i = 0; i < 3; i++)
         {
-            vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter] = 0.0f;
-            vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter + 1] = 0.0f;
-            vertexData[currentBuffer].tcCounter++;
+            prim->u[i] = texcoords[order[i]][0];
+            prim->v[i] = texcoords[order[i]][1];
+            for (int c = 0; c < 4; c++) prim->color[i][c] = colors[order[i]][c];
         }
     }
 
-    // TODO: Make sure normals count match vertex count... if normals support is added in a future... :P
-
-    // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
-    // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
-    // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
-    currentDepth += (1.0f/20000.0f);
+    prim->constantColor = prim->affine && (memcmp(colors[0], colors[1], 4) == 0) && (memcmp(colors[0], colors[2], 4) == 0);
 
-    // Verify internal buffers limits
-    // NOTE: This check is combined with usage of rlCheckBufferLimit()
-    if ((vertexData[currentBuffer].vCounter) >= (MAX_BATCH_ELEMENTS*4 - 4))
+    // Bounding box, pixels with center inside clipping rectangle
+    long long minX = prim->x[0], maxX = prim->x[0], minY = prim->y[0], maxY = prim->y[0];
+    for (int i = 1; i < 3; i++)
     {
-        // WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a rlglDraw(),
-        // we need to call rlPopMatrix() before to recover *currentMatrix (modelview) for the next forced draw call!
-        // If we have multiple matrix pushed, it will require "stackCounter" pops before launching the draw
-        for (int i = stackCounter; i >= 0; i--) rlPopMatrix();
-        rlglDraw();
+        if (prim->x[i] < minX) minX = prim->x[i];
+        if (prim->x[i] > maxX) maxX = prim->x[i];
+        if (prim->y[i] < minY) minY = prim->y[i];
+        if (prim->y[i] > maxY) maxY = prim->y[i];
     }
-}
 
-// Define one vertex (position)
-// NOTE: Vertex position data is the basic information required for drawing
-void rlVertex3f(float x, float y, float z)
-{
-    Vector3 vec = { x, y, z };
+    prim->minX = (int)(minX >> SW_SUBPIXEL_BITS);
+    prim->minY = (int)(minY >> SW_SUBPIXEL_BITS);
+    prim->maxX = (int)(maxX >> SW_SUBPIXEL_BITS);
+    prim->maxY = (int)(maxY >> SW_SUBPIXEL_BITS);
+
+    if (prim->minX < clipRec[0]) prim->minX = clipRec[0];
+    if (prim->minY < clipRec[1]) prim->minY = clipRec[1];
+    if (prim->maxX > clipRec[2]) prim->maxX = clipRec[2];
+    if (prim->maxY > clipRec[3]) prim->maxY = clipRec[3];
 
-    // Transform provided vector if required
-    if (useTransformMatrix) vec = Vector3Transform(vec, transformMatrix);
+    if ((prim->minX > prim->maxX) || (prim->minY > prim->maxY)) return false;
 
-    // Verify that MAX_BATCH_ELEMENTS limit not reached
-    if (vertexData[currentBuffer].vCounter < (MAX_BATCH_ELEMENTS*4))
+    // Flat primitives: same color on all vertex and single texel texture (i.e. default white texture)
+    prim->flat = ((prim->texture == NULL) || ((prim->texture->width == 1) && (prim->texture->height == 1))) &&
+                 (memcmp(colors[0], colors[1], 4) == 0) && (memcmp(colors[0], colors[2], 4) == 0);
+
+    if (prim->flat)
     {
-        vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter] = vec.x;
-        vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter + 1] = vec.y;
-        vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter + 2] = vec.z;
-        vertexData[currentBuffer].vCounter++;
+        float texel[4] = { 255.0f, 255.0f, 255.0f, 255.0f };
+        if (prim->texture != NULL) SwTexel(prim->texture, 0, 0, texel);
 
-        draws[drawsCounter - 1].vertexCount++;
+        for (int c = 0; c < 4; c++) prim->flatColor[c] = (unsigned char)((colors[0][c]*texel[c])/255.0f + 0.5f);
     }
-    else TraceLog(LOG_ERROR, "MAX_BATCH_ELEMENTS overflow");
-}
 
-// Define one vertex (position)
-void rlVertex2f(float x, float y)
-{
-    rlVertex3f(x, y, currentDepth);
+    return true;
 }
 
-// Define one vertex (position)
-void rlVertex2i(int x, int y)
+// Rasterize batch draws into current framebuffer
+static void SwRasterizeBatch(const rlQuadVertex *vertices, const rlRecordDraw *draws, int drawsCount, Matrix mvp)
 {
-    rlVertex3f((float)x, (float)y, currentDepth);
-}
+    RecordTexture *target = SwGetTarget();
+    if ((target == NULL) || (target->pixels == NULL)) return;
 
-// Define one vertex (texture coordinate)
-// NOTE: Texture coordinates are limited to QUADS only
-void rlTexCoord2f(float x, float y)
-{
-    vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter] = x;
-    vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter + 1] = y;
-    vertexData[currentBuffer].tcCounter++;
-}
+    // Count triangles: quads are split in two triangles, lines are rasterized as one pixel wide quads
+    int primitivesCount = 0;
+    for (int i = 0; i < drawsCount; i++)
+    {
+        if (draws[i].mode == RL_TRIANGLES) primitivesCount += draws[i].vertexCount/3;
+        else if (draws[i].mode == RL_QUADS) primitivesCount += draws[i].vertexCount/2;
+        else primitivesCount += draws[i].vertexCount;
+    }
 
-// Define one vertex (normal)
-// NOTE: Normals limited to TRIANGLES only?
-void rlNormal3f(float x, float y, float z)
-{
-    // TODO: Normals usage...
-}
+    if (primitivesCount > swPrimitivesCapacity)
+    {
+        swPrimitivesCapacity = primitivesCount;
+        swPrimitives = (SwPrimitive *)RL_REALLOC(swPrimitives, sizeof(SwPrimitive)*swPrimitivesCapacity);
+    }
 
-// Define one vertex (color)
-void rlColor4ub(byte x, byte y, byte z, byte w)
-{
-    vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter] = x;
-    vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 1] = y;
-    vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 2] = z;
-    vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 3] = w;
-    vertexData[currentBuffer].cCounter++;
-}
+    int count = 0;
 
-// Define one vertex (color)
-void rlColor4f(float r, float g, float b, float a)
-{
-    rlColor4ub((byte)(r*255), (byte)(g*255), (byte)(b*255), (byte)(a*255));
-}
+    for (int i = 0; i < drawsCount; i++)
+    {
+        const rlRecordDraw *draw = &draws[i];
 
-// Define one vertex (color)
-void rlColor3f(float x, float y, float z)
-{
-    rlColor4ub((byte)(x*255), (byte)(y*255), (byte)(z*255), 255);
-}
+        // Clipping rectangle (inclusive): target, viewport and scissor
+        int clipRec[4] = { 0, 0, target->width - 1, target->height - 1 };
+        int rects = draw->scissorEnabled? 2 : 1;
 
-#endif
+        for (int r = 0; r < rects; r++)
+        {
+            const int *rec = (r == 0)? swViewport : draw->scissorRec;
+            if (rec[0] > clipRec[0]) clipRec[0] = rec[0];
+            if (rec[1] > clipRec[1]) clipRec[1] = rec[1];
+            if (rec[0] + rec[2] - 1 < clipRec[2]) clipRec[2] = rec[0] + rec[2] - 1;
+            if (rec[1] + rec[3] - 1 < clipRec[3]) clipRec[3] = rec[1] + rec[3] - 1;
+        }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - OpenGL equivalent functions (common to 1.1, 3.3+, ES2)
-//----------------------------------------------------------------------------------
+        RecordTexture *textures[MAX_BATCH_TEXTURES] = { 0 };
+        for (int t = 0; t < draw->texturesCount; t++)
+        {
+            textures[t] = SwFindTexture(draw->textures[t]);
+            if ((textures[t] != NULL) && (textures[t]->pixels == NULL)) textures[t] = NULL;
+        }
 
-// Enable texture usage
-void rlEnableTexture(unsigned int id)
-{
-#if defined(GRAPHICS_API_OPENGL_11)
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, id);
-#endif
+        int verticesPerPrimitive = (draw->mode == RL_TRIANGLES)? 3 : (draw->mode == RL_QUADS)? 4 : 2;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (draws[drawsCounter - 1].textureId != id)
-    {
-        if (draws[drawsCounter - 1].vertexCount > 0)
+        for (int k = 0; k + verticesPerPrimitive <= draw->vertexCount; k += verticesPerPrimitive)
         {
-            // Make sure current draws[i].vertexCount is aligned a multiple of 4,
-            // that way, following QUADS drawing will keep aligned with index processing
-            // It implies adding some extra alignment vertex at the end of the draw,
-            // those vertex are not processed but they are considered as an additional offset
-            // for the next set of vertex to be drawn
-            if (draws[drawsCounter - 1].mode == RL_LINES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? draws[drawsCounter - 1].vertexCount : draws[drawsCounter - 1].vertexCount%4);
-            else if (draws[drawsCounter - 1].mode == RL_TRIANGLES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? 1 : (4 - (draws[drawsCounter - 1].vertexCount%4)));
+            const rlQuadVertex *v = &vertices[draw->vertexOffset + k];
+            float clip[4][4];
 
-            else draws[drawsCounter - 1].vertexAlignment = 0;
+            for (int n = 0; n < verticesPerPrimitive; n++)
+            {
+                clip[n][0] = mvp.m0*v[n].x + mvp.m4*v[n].y + mvp.m8*v[n].z + mvp.m12;
+                clip[n][1] = mvp.m1*v[n].x + mvp.m5*v[n].y + mvp.m9*v[n].z + mvp.m13;
+                clip[n][2] = mvp.m2*v[n].x + mvp.m6*v[n].y + mvp.m10*v[n].z + mvp.m14;
+                clip[n][3] = mvp.m3*v[n].x + mvp.m7*v[n].y + mvp.m11*v[n].z + mvp.m15;
+            }
 
-            if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDraw();
-            else
+            const float *texcoords[4];
+            const unsigned char *colors[4];
+            for (int n = 0; n < verticesPerPrimitive; n++)
             {
-                vertexData[currentBuffer].vCounter += draws[drawsCounter - 1].vertexAlignment;
-                vertexData[currentBuffer].cCounter += draws[drawsCounter - 1].vertexAlignment;
-                vertexData[currentBuffer].tcCounter += draws[drawsCounter - 1].vertexAlignment;
+                texcoords[n] = &v[n].u;
+                colors[n] = &v[n].r;
+            }
+
+            if (draw->mode == RL_LINES)
+            {
+                // Line expanded into a one pixel wide quad (clip space, same w on both sides)
+                float dx = (clip[1][0]/clip[1][3] - clip[0][0]/clip[0][3])*swViewport[2];
+                float dy = (clip[1][1]/clip[1][3] - clip[0][1]/clip[0][3])*swViewport[3];
+                float length = sqrtf(dx*dx + dy*dy);
+                if ((length == 0.0f) || (clip[0][3] <= 1e-6f) || (clip[1][3] <= 1e-6f)) continue;
+
+                float nx = -dy/length/swViewport[2];
+                float ny = dx/length/swViewport[3];
+
+                float line[4][4];
+                for (int n = 0; n < 4; n++)
+                {
+                    int src = (n < 2)? 0 : 1;
+                    float side = ((n == 0) || (n == 3))? 1.0f : -1.0f;
+                    line[n][0] = clip[src][0] + side*nx*clip[src][3];
+                    line[n][1] = clip[src][1] + side*ny*clip[src][3];
+                    line[n][2] = clip[src][2];
+                    line[n][3] = clip[src][3];
+                }
+
+                memcpy(clip, line, sizeof(line));
+                texcoords[2] = texcoords[1]; texcoords[3] = texcoords[1]; texcoords[1] = texcoords[0];
+                colors[2] = colors[1]; colors[3] = colors[1]; colors[1] = colors[0];
+            }
+
+            // Quads (and lines) split in two triangles: 0-1-2, 0-2-3
+            int trianglesCount = (verticesPerPrimitive == 3)? 1 : 2;
+
+            for (int t = 0; t < trianglesCount; t++)
+            {
+                int index[3] = { 0, 1 + t, 2 + t };
+                float triangle[3][4];
+                const float *triangleTexcoords[3];
+                const unsigned char *triangleColors[3];
+
+                for (int n = 0; n < 3; n++)
+                {
+                    memcpy(triangle[n], clip[index[n]], sizeof(float)*4);
+                    triangleTexcoords[n] = texcoords[index[n]];
+                    triangleColors[n] = colors[index[n]];
+                }
+
+                SwPrimitive *prim = &swPrimitives[count];
+                prim->blendMode = draw->blendMode;
+                prim->texture = (v[0].slot < MAX_BATCH_TEXTURES)? textures[v[0].slot] : NULL;
 
-                drawsCounter++;
+                if (SwSetupTriangle(prim, triangle, triangleTexcoords, triangleColors, clipRec)) count++;
             }
         }
+    }
+
+    if (count == 0) return;
 
-        if (drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+    // Bin primitives into tiles (two passes: count and fill), keeping primitives order
+    int tilesX = (target->width + SW_TILE_SIZE - 1)/SW_TILE_SIZE;
+    int tilesY = (target->height + SW_TILE_SIZE - 1)/SW_TILE_SIZE;
+    int tilesCount = tilesX*tilesY;
 
-        draws[drawsCounter - 1].textureId = id;
-        draws[drawsCounter - 1].vertexCount = 0;
+    if (tilesCount + 1 > swTileOffsetsCapacity)
+    {
+        swTileOffsetsCapacity = tilesCount + 1;
+        swTileOffsets = (int *)RL_REALLOC(swTileOffsets, sizeof(int)*swTileOffsetsCapacity);
     }
-#endif
-}
 
-// Disable texture usage
-void rlDisableTexture(void)
-{
-#if defined(GRAPHICS_API_OPENGL_11)
-    glDisable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    memset(swTileOffsets, 0, sizeof(int)*(tilesCount + 1));
+
+    int itemsCount = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const SwPrimitive *prim = &swPrimitives[i];
+        for (int ty = prim->minY/SW_TILE_SIZE; ty <= prim->maxY/SW_TILE_SIZE; ty++)
+        {
+            for (int tx = prim->minX/SW_TILE_SIZE; tx <= prim->maxX/SW_TILE_SIZE; tx++) swTileOffsets[ty*tilesX + tx + 1]++;
+        }
+    }
+
+    for (int i = 0; i < tilesCount; i++) swTileOffsets[i + 1] += swTileOffsets[i];
+    itemsCount = swTileOffsets[tilesCount];
+
+    if (itemsCount > swTileItemsCapacity)
+    {
+        swTileItemsCapacity = itemsCount;
+        swTileItems = (int *)RL_REALLOC(swTileItems, sizeof(int)*swTileItemsCapacity);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const SwPrimitive *prim = &swPrimitives[i];
+        for (int ty = prim->minY/SW_TILE_SIZE; ty <= prim->maxY/SW_TILE_SIZE; ty++)
+        {
+            for (int tx = prim->minX/SW_TILE_SIZE; tx <= prim->maxX/SW_TILE_SIZE; tx++) swTileItems[swTileOffsets[ty*tilesX + tx]++] = i;
+        }
+    }
+
+    // Fill pass moved offsets to the end of every tile list, restore them
+    for (int i = tilesCount; i > 0; i--) swTileOffsets[i] = swTileOffsets[i - 1];
+    swTileOffsets[0] = 0;
+
+    SwRasterJob job = { 0 };
+    job.target = target;
+    job.primitives = swPrimitives;
+    job.tileOffsets = swTileOffsets;
+    job.tileItems = swTileItems;
+    job.tilesX = tilesX;
+    job.tilesCount = tilesCount;
+
+#if !defined(_WIN32)
+    if (swThreadsCount == 0)
+    {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        swThreadsCount = (cores < 1)? 1 : (cores > SW_MAX_THREADS)? SW_MAX_THREADS : (int)cores;
+        TraceLog(LOG_INFO, "Software backend: rasterization threads: %i", swThreadsCount);
+    }
+
+    int threadsCount = (count < SW_MIN_THREADED_PRIMITIVES)? 1 : (swThreadsCount < tilesCount)? swThreadsCount : tilesCount;
+
+    if (threadsCount > 1)
+    {
+        pthread_t threads[SW_MAX_THREADS];
+        pthread_mutex_init(&job.mutex, NULL);
+
+        int started = 0;
+        for (int i = 0; i < threadsCount - 1; i++)
+        {
+            if (pthread_create(&threads[started], NULL, SwRasterizeTiles, &job) == 0) started++;
+        }
+
+        SwRasterizeTiles(&job);
+
+        for (int i = 0; i < started; i++) pthread_join(threads[i], NULL);
+        pthread_mutex_destroy(&job.mutex);
+    }
+    else
+    {
+        pthread_mutex_init(&job.mutex, NULL);
+        SwRasterizeTiles(&job);
+        pthread_mutex_destroy(&job.mutex);
+    }
 #else
-    // NOTE: If quads batch limit is reached,
-    // we force a draw call and next batch starts
-    if (vertexData[currentBuffer].vCounter >= (MAX_BATCH_ELEMENTS*4)) rlglDraw();
+    SwRasterizeTiles(&job);
 #endif
 }
 
-// Set texture parameters (wrap mode/filter mode)
-void rlTextureParameters(unsigned int id, int param, int value)
+// Unload software backend buffers
+static void SwClose(void)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
-
-    switch (param)
+    for (int i = 0; i < recordTexturesCounter; i++) RL_FREE(recordTextures[i].pixels);
+
+    RL_FREE(swScreen.pixels);
+    RL_FREE(swPrimitives);
+    RL_FREE(swTileOffsets);
+    RL_FREE(swTileItems);
+
+    memset(&swScreen, 0, sizeof(RecordTexture));
+    swPrimitives = NULL;
+    swPrimitivesCapacity = 0;
+    swTileOffsets = NULL;
+    swTileOffsetsCapacity = 0;
+    swTileItems = NULL;
+    swTileItemsCapacity = 0;
+    swFramebuffersCounter = 0;
+}
+#endif  // GRAPHICS_API_SOFTWARE
+
+// Objects generation and deletion
+static void glGenBuffers(GLsizei n, GLuint *buffers) { RecordGenIds(n, buffers); }
+static void glGenVertexArrays(GLsizei n, GLuint *arrays) { RecordGenIds(n, arrays); }
+static void glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { RecordGenIds(n, renderbuffers); }
+static void glGenTextures(GLsizei n, GLuint *textures) { RecordGenIds(n, textures); }
+static void glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    RecordGenIds(n, framebuffers);
+    for (int i = 0; i < n; i++) RecordCommand(RL_RECORD_FRAMEBUFFER_LOAD, framebuffers[i]);
+}
+static void glDeleteBuffers(GLsizei n, const GLuint *buffers) { }
+static void glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { }
+static void glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { }
+static void glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    for (int i = 0; i < n; i++)
     {
-        case RL_TEXTURE_WRAP_S:
-        case RL_TEXTURE_WRAP_T:
+        for (int k = 0; k < recordTexturesCounter; k++)
         {
-            if (value == RL_WRAP_MIRROR_CLAMP)
+            if (recordTextures[k].id == textures[i])
             {
-#if !defined(GRAPHICS_API_OPENGL_11)
-                if (texMirrorClampSupported) glTexParameteri(GL_TEXTURE_2D, param, value);
-                else TraceLog(LOG_WARNING, "Clamp mirror wrap mode not supported");
-#endif
+                RL_FREE(recordTextures[k].pixels);
+                recordTextures[k] = recordTextures[recordTexturesCounter - 1];
+                recordTexturesCounter--;
+                RecordCommand(RL_RECORD_TEXTURE_UNLOAD, textures[i]);
+                break;
             }
-            else glTexParameteri(GL_TEXTURE_2D, param, value);
-
-        } break;
-        case RL_TEXTURE_MAG_FILTER:
-        case RL_TEXTURE_MIN_FILTER: glTexParameteri(GL_TEXTURE_2D, param, value); break;
-        case RL_TEXTURE_ANISOTROPIC_FILTER:
+        }
+    }
+}
+static void glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    for (int i = 0; i < n; i++)
+    {
+#if defined(GRAPHICS_API_SOFTWARE)
+        for (int k = 0; k < swFramebuffersCounter; k++)
         {
-#if !defined(GRAPHICS_API_OPENGL_11)
-            if (value <= maxAnisotropicLevel) glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
-            else if (maxAnisotropicLevel > 0.0f)
+            if (swFramebuffers[k].id == framebuffers[i])
             {
-                TraceLog(LOG_WARNING, "[TEX ID %i] Maximum anisotropic filter level supported is %iX", id, maxAnisotropicLevel);
-                glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
+                swFramebuffers[k] = swFramebuffers[swFramebuffersCounter - 1];
+                swFramebuffersCounter--;
+                break;
             }
-            else TraceLog(LOG_WARNING, "Anisotropic filtering not supported");
+        }
 #endif
-        } break;
-        default: break;
+        RecordCommand(RL_RECORD_FRAMEBUFFER_UNLOAD, framebuffers[i]);
     }
-
-    glBindTexture(GL_TEXTURE_2D, 0);
 }
 
-// Enable rendering to texture (fbo)
-void rlEnableRenderTexture(unsigned int id)
+// Objects binding
+static void glBindBuffer(GLenum target, GLuint buffer) { }
+static void glBindVertexArray(GLuint array) { }
+static void glBindRenderbuffer(GLenum target, GLuint renderbuffer) { }
+static void glBindTexture(GLenum target, GLuint texture) { recordTextureUnits[recordActiveTexture] = texture; }
+static void glBindFramebuffer(GLenum target, GLuint framebuffer) { recordFramebuffer = framebuffer; }
+static void glActiveTexture(GLenum texture) { recordActiveTexture = texture - GL_TEXTURE0; }
+
+// Buffers data
+static void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { }
+static void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { }
+static void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { }
+static void glEnableVertexAttribArray(GLuint index) { }
+static void glDisableVertexAttribArray(GLuint index) { }
+static void glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { }
+static void glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { }
+static void glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { }
+
+// Textures data
+static void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
-
-    //glDisable(GL_CULL_FACE);    // Allow double side drawing for texture flipping
-    //glCullFace(GL_FRONT);
+    if (level > 0) return;
+
+    RecordTexture *texture = RecordGetTexture(recordTextureUnits[recordActiveTexture]);
+    texture->width = width;
+    texture->height = height;
+    texture->format = internalformat;
+
+#if defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: Compressed formats are not decoded (format 0), texture is kept transparent
+    RL_FREE(texture->pixels);
+    texture->pixels = (unsigned char *)RL_CALLOC(width*height*4, 1);
+    if ((pixels != NULL) && (format != 0)) SwConvertPixels(texture, 0, 0, width, height, format, type, pixels);
 #endif
-}
 
-// Disable rendering to texture
-void rlDisableRenderTexture(void)
+    rlRecordCommand *command = RecordCommand(RL_RECORD_TEXTURE_LOAD, recordTextureUnits[recordActiveTexture]);
+    command->params[0] = width;
+    command->params[1] = height;
+    command->params[2] = internalformat;
+    command->params[3] = target;
+}
+static void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    //glEnable(GL_CULL_FACE);
-    //glCullFace(GL_BACK);
-#endif
+    glTexImage2D(target, level, internalformat, width, height, border, 0, 0, data);
 }
+static void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    if (level > 0) return;
 
-// Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
-
-// Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
-
-// Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
-
-// Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
-
-// Enable scissor test
-RLAPI void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
-
-// Disable scissor test
-RLAPI void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
-
-// Scissor test
-RLAPI void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+#if defined(GRAPHICS_API_SOFTWARE)
+    RecordTexture *texture = SwFindTexture(recordTextureUnits[recordActiveTexture]);
+    if ((texture != NULL) && (texture->pixels != NULL)) SwConvertPixels(texture, xoffset, yoffset, width, height, format, type, pixels);
+#endif
 
-// Enable wire mode
-void rlEnableWireMode(void)
+    rlRecordCommand *command = RecordCommand(RL_RECORD_TEXTURE_UPDATE, recordTextureUnits[recordActiveTexture]);
+    command->params[0] = xoffset;
+    command->params[1] = yoffset;
+    command->params[2] = width;
+    command->params[3] = height;
+}
+static void glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
 {
-#if defined (GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: glPolygonMode() not available on OpenGL ES
-    glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+    RecordTexture *texture = RecordGetTexture(recordTextureUnits[recordActiveTexture]);
+
+    if ((texture == NULL) || (pixels == NULL)) return;
+#if defined(GRAPHICS_API_SOFTWARE)
+    SwReadPixels(texture, 0, 0, texture->width, texture->height, format, type, pixels);
+#else
+    // NOTE: No pixel data is kept, provided buffer is cleared (size given by pixel format and type)
+    memset(pixels, 0, texture->width*texture->height*RecordPixelSize(format, type));
 #endif
 }
-
-// Disable wire mode
-void rlDisableWireMode(void)
+static void glTexParameteri(GLenum target, GLenum pname, GLint param)
 {
-#if defined (GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: glPolygonMode() not available on OpenGL ES
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+#if defined(GRAPHICS_API_SOFTWARE)
+    RecordTexture *texture = RecordGetTexture(recordTextureUnits[recordActiveTexture]);
+
+    if (pname == GL_TEXTURE_MAG_FILTER) texture->magFilter = param;
+    else if (pname == GL_TEXTURE_WRAP_S) texture->wrapS = param;
+    else if (pname == GL_TEXTURE_WRAP_T) texture->wrapT = param;
 #endif
 }
-
-// Unload texture from GPU memory
-void rlDeleteTextures(unsigned int id)
+static void glTexParameteriv(GLenum target, GLenum pname, const GLint *params)
 {
-    if (id > 0) glDeleteTextures(1, &id);
+#if defined(GRAPHICS_API_SOFTWARE)
+    if (pname == GL_TEXTURE_SWIZZLE_RGBA)
+    {
+        RecordTexture *texture = RecordGetTexture(recordTextureUnits[recordActiveTexture]);
+        for (int i = 0; i < 4; i++) texture->swizzle[i] = params[i];
+        texture->swizzled = true;
+    }
+#endif
 }
+static void glTexParameterf(GLenum target, GLenum pname, GLfloat param) { }
+static void glGenerateMipmap(GLenum target) { }
+static void glPixelStorei(GLenum pname, GLint param) { }
 
-// Unload render texture from GPU memory
-void rlDeleteRenderTextures(RenderTexture2D target)
+// Framebuffers
+static void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { }
+static void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (target.texture.id > 0) glDeleteTextures(1, &target.texture.id);
-    if (target.depth.id > 0)
+#if defined(GRAPHICS_API_SOFTWARE)
+    if (attachment == GL_COLOR_ATTACHMENT0)
     {
-        if (target.depthTexture) glDeleteTextures(1, &target.depth.id);
-        else glDeleteRenderbuffers(1, &target.depth.id);
-    }
-
-    if (target.id > 0) glDeleteFramebuffers(1, &target.id);
+        int index = 0;
+        while ((index < swFramebuffersCounter) && (swFramebuffers[index].id != recordFramebuffer)) index++;
 
-    TraceLog(LOG_INFO, "[FBO ID %i] Unloaded render texture data from VRAM (GPU)", target.id);
+        if (index < MAX_SW_FRAMEBUFFERS)
+        {
+            swFramebuffers[index].id = recordFramebuffer;
+            swFramebuffers[index].texture = texture;
+            if (index == swFramebuffersCounter) swFramebuffersCounter++;
+        }
+    }
 #endif
-}
 
-// Unload shader from GPU memory
-void rlDeleteShader(unsigned int id)
+    rlRecordCommand *command = RecordCommand(RL_RECORD_FRAMEBUFFER_ATTACH, recordFramebuffer);
+    command->params[0] = attachment;
+    command->params[1] = texture;
+}
+static void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (id != 0) glDeleteProgram(id);
+    rlRecordCommand *command = RecordCommand(RL_RECORD_FRAMEBUFFER_ATTACH, recordFramebuffer);
+    command->params[0] = attachment;
+    command->params[1] = renderbuffer;
+}
+static GLenum glCheckFramebufferStatus(GLenum target) { return GL_FRAMEBUFFER_COMPLETE; }
+static void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    // NOTE: Reads into a pixel pack buffer (offset pixels) are not recorded
+    if (pixels == NULL) return;
+#if defined(GRAPHICS_API_SOFTWARE)
+    SwReadPixels(SwGetTarget(), x, y, width, height, format, type, pixels);
+#else
+    // NOTE: No framebuffer data is kept, provided buffer is cleared (size given by pixel format and type)
+    memset(pixels, 0, width*height*RecordPixelSize(format, type));
 #endif
 }
 
-// Unload vertex data (VAO) from GPU memory
-void rlDeleteVertexArrays(unsigned int id)
+// Shaders
+static GLuint glCreateShader(GLenum type) { return ++recordIdCounter; }
+static void glShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length) { }
+static void glCompileShader(GLuint shader) { }
+static void glDeleteShader(GLuint shader) { }
+static void glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { *params = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0; }
+static void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { if (length != NULL) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+static GLuint glCreateProgram(void) { return ++recordIdCounter; }
+static void glAttachShader(GLuint program, GLuint shader) { }
+static void glDetachShader(GLuint program, GLuint shader) { }
+static void glLinkProgram(GLuint program) { RecordCommand(RL_RECORD_SHADER_LOAD, program); }
+static void glDeleteProgram(GLuint program) { RecordCommand(RL_RECORD_SHADER_UNLOAD, program); }
+static void glUseProgram(GLuint program) { recordProgram = program; }
+static void glGetProgramiv(GLuint program, GLenum pname, GLint *params)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (vaoSupported)
+    // NOTE: Every uniform name registered (glGetUniformLocation()) is considered active on every program
+    if (pname == GL_LINK_STATUS) *params = GL_TRUE;
+    else if (pname == GL_ACTIVE_UNIFORMS) *params = recordUniformsCounter;
+    else *params = 0;
+}
+static void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { if (length != NULL) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+static void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    int nameLength = (int)strlen(recordUniforms[index]);
+    if (nameLength > (bufSize - 1)) nameLength = bufSize - 1;
+
+    memcpy(name, recordUniforms[index], nameLength);
+    name[nameLength] = '\0';
+    *length = nameLength;
+    *size = 1;
+    *type = GL_ZERO;
+}
+static void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+    if (recordAttribsCounter < MAX_RECORD_ATTRIB_BINDINGS)
     {
-        if (id != 0) glDeleteVertexArrays(1, &id);
-        TraceLog(LOG_INFO, "[VAO ID %i] Unloaded model data from VRAM (GPU)", id);
+        recordAttribs[recordAttribsCounter].program = program;
+        recordAttribs[recordAttribsCounter].index = index;
+        snprintf(recordAttribs[recordAttribsCounter].name, sizeof(recordAttribs[recordAttribsCounter].name), "%s", name);
+        recordAttribsCounter++;
     }
-#endif
 }
-
-// Unload vertex data (VBO) from GPU memory
-void rlDeleteBuffers(unsigned int id)
+static GLint glGetAttribLocation(GLuint program, const GLchar *name)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (id != 0)
+    // NOTE: Only attributes with binded locations are available
+    for (int i = 0; i < recordAttribsCounter; i++)
     {
-        glDeleteBuffers(1, &id);
-        if (!vaoSupported) TraceLog(LOG_INFO, "[VBO ID %i] Unloaded model vertex data from VRAM (GPU)", id);
+        if ((recordAttribs[i].program == program) && (strcmp(recordAttribs[i].name, name) == 0)) return recordAttribs[i].index;
     }
-#endif
-}
 
-// Clear color buffer with color
-void rlClearColor(byte r, byte g, byte b, byte a)
+    return -1;
+}
+static GLint glGetUniformLocation(GLuint program, const GLchar *name)
 {
-    // Color values clamp to 0.0f(0) and 1.0f(255)
-    float cr = (float)r/255;
-    float cg = (float)g/255;
-    float cb = (float)b/255;
-    float ca = (float)a/255;
+    // NOTE: Same location for same uniform name on every program
+    for (int i = 0; i < recordUniformsCounter; i++) if (strcmp(recordUniforms[i], name) == 0) return i;
 
-    glClearColor(cr, cg, cb, ca);
-}
+    if (recordUniformsCounter < MAX_RECORD_UNIFORM_NAMES)
+    {
+        snprintf(recordUniforms[recordUniformsCounter], sizeof(recordUniforms[recordUniformsCounter]), "%s", name);
+        recordUniformsCounter++;
+        return recordUniformsCounter - 1;
+    }
 
-// Clear used screen buffers (color and depth)
-void rlClearScreenBuffers(void)
-{
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
-    //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
+    return -1;
 }
+static void glUniform1i(GLint location, GLint v0) { }
+static void glUniform1f(GLint location, GLfloat v0) { }
+static void glUniform2f(GLint location, GLfloat v0, GLfloat v1) { }
+static void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { }
+static void glUniform1iv(GLint location, GLsizei count, const GLint *value) { }
+static void glUniform2iv(GLint location, GLsizei count, const GLint *value) { }
+static void glUniform3iv(GLint location, GLsizei count, const GLint *value) { }
+static void glUniform4iv(GLint location, GLsizei count, const GLint *value) { }
+static void glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { }
+static void glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { }
+static void glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { }
+static void glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { }
+static void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { }
+
+// Drawing
+// NOTE: Batch draw calls are recorded as a single flush command, only other draws are recorded here
+static void glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    if (recordBatchDrawing) return;
 
-// Update GPU buffer with new data
-void rlUpdateBuffer(int bufferId, void *data, int dataSize)
+    rlRecordCommand *command = RecordCommand(RL_RECORD_DRAW, recordProgram);
+    command->params[0] = mode;
+    command->params[1] = count;
+    command->params[2] = recordTextureUnits[0];    // NOTE: Diffuse texture (texture unit 0)
+}
+static void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { glDrawArrays(mode, 0, count); }
+
+// State
+static void glEnable(GLenum cap) { }
+static void glDisable(GLenum cap) { }
+static void glBlendFunc(GLenum sfactor, GLenum dfactor) { }
+static void glDepthFunc(GLenum func) { }
+static void glDepthMask(GLboolean flag) { }
+static void glCullFace(GLenum mode) { }
+static void glFrontFace(GLenum mode) { }
+static void glPolygonMode(GLenum face, GLenum mode) { }
+static void glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { }
+static void glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, bufferId);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+#if defined(GRAPHICS_API_SOFTWARE)
+    swViewport[0] = x;
+    swViewport[1] = y;
+    swViewport[2] = width;
+    swViewport[3] = height;
 #endif
+
+    rlRecordCommand *command = RecordCommand(RL_RECORD_VIEWPORT, recordFramebuffer);
+    command->params[0] = x;
+    command->params[1] = y;
+    command->params[2] = width;
+    command->params[3] = height;
 }
+static void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    recordClearColor[0] = red;
+    recordClearColor[1] = green;
+    recordClearColor[2] = blue;
+    recordClearColor[3] = alpha;
+}
+static void glClearDepth(GLdouble depth) { }
+static void glClear(GLbitfield mask)
+{
+#if defined(GRAPHICS_API_SOFTWARE)
+    RecordTexture *target = SwGetTarget();
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - rlgl Functions
-//----------------------------------------------------------------------------------
+    if ((mask & GL_COLOR_BUFFER_BIT) && (target != NULL) && (target->pixels != NULL))
+    {
+        unsigned char color[4];
+        for (int i = 0; i < 4; i++) color[i] = (unsigned char)(((recordClearColor[i] < 0.0f)? 0.0f : (recordClearColor[i] > 1.0f)? 1.0f : recordClearColor[i])*255.0f + 0.5f);
 
-// Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
-void rlglInit(int width, int height)
+        for (int i = 0; i < target->width*target->height; i++) memcpy(target->pixels + i*4, color, 4);
+    }
+#endif
+
+    rlRecordCommand *command = RecordCommand(RL_RECORD_CLEAR, recordFramebuffer);
+    command->params[0] = mask;
+    for (int i = 0; i < 4; i++) command->color[i] = recordClearColor[i];
+}
+
+// Queries
+static const GLubyte *glGetString(GLenum name)
 {
-    // Check OpenGL information and capabilities
-    //------------------------------------------------------------------------------
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+#if defined(GRAPHICS_API_SOFTWARE)
+        case GL_RENDERER: return (const GLubyte *)"rlgl software backend";
+#else
+        case GL_RENDERER: return (const GLubyte *)"rlgl record backend";
+#endif
+        case GL_VERSION: return (const GLubyte *)"3.3 (record)";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"3.30 (record)";
+        default: return (const GLubyte *)"";
+    }
+}
+static const GLubyte *glGetStringi(GLenum name, GLuint index) { return (const GLubyte *)""; }
+static void glGetIntegerv(GLenum pname, GLint *data) { *data = 0; }
+static void glGetFloatv(GLenum pname, GLfloat *data) { *data = 0.0f; }
+
+// Not supported features (rlgl checks availability)
+static void (*glBufferStorage)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) = NULL;
+static void *(*glMapBufferRange)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) = NULL;
+static GLboolean (*glUnmapBuffer)(GLenum target) = NULL;
+static GLsync (*glFenceSync)(GLenum condition, GLbitfield flags) = NULL;
+static GLenum (*glClientWaitSync)(GLsync sync, GLbitfield flags, GLuint64 timeout) = NULL;
+static void (*glDeleteSync)(GLsync sync) = NULL;
+static void (*glDrawArraysInstanced)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) = NULL;
+static void (*glDrawElementsInstanced)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) = NULL;
+static void (*glVertexAttribDivisor)(GLuint index, GLuint divisor) = NULL;
+static void (*glInsertEventMarkerEXT)(GLsizei length, const GLchar *marker) = NULL;
+static void (*glGenQueries)(GLsizei n, GLuint *ids) = NULL;
+static void (*glDeleteQueries)(GLsizei n, const GLuint *ids) = NULL;
+static void (*glQueryCounter)(GLuint id, GLenum target) = NULL;
+static void (*glGetQueryObjectiv)(GLuint id, GLenum pname, GLint *params) = NULL;
+static void (*glGetQueryObjectui64v)(GLuint id, GLenum pname, GLuint64 *params) = NULL;
+static void (*glGetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) = NULL;
+static void (*glProgramBinary)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) = NULL;
+static void (*glProgramParameteri)(GLuint program, GLenum pname, GLint value) = NULL;
+#endif  // GRAPHICS_API_NONE
 
-    // Print current OpenGL and GLSL version
-    TraceLog(LOG_INFO, "GPU: Vendor:   %s", glGetString(GL_VENDOR));
-    TraceLog(LOG_INFO, "GPU: Renderer: %s", glGetString(GL_RENDERER));
-    TraceLog(LOG_INFO, "GPU: Version:  %s", glGetString(GL_VERSION));
-    TraceLog(LOG_INFO, "GPU: GLSL:     %s", glGetString(GL_SHADING_LANGUAGE_VERSION));
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef GL_SHADING_LANGUAGE_VERSION
+    #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
+#endif
 
-    // NOTE: We can get a bunch of extra information about GPU capabilities (glGet*)
-    //int maxTexSize;
-    //glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTexSize);
-    //TraceLog(LOG_INFO, "GL_MAX_TEXTURE_SIZE: %i", maxTexSize);
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT     0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT    0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT    0x83F2
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT    0x83F3
+#endif
+#ifndef GL_ETC1_RGB8_OES
+    #define GL_ETC1_RGB8_OES                    0x8D64
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+    #define GL_COMPRESSED_RGB8_ETC2             0x9274
+#endif
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+    #define GL_COMPRESSED_RGBA8_ETC2_EAC        0x9278
+#endif
+#ifndef GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG
+    #define GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG  0x8C00
+#endif
+#ifndef GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG
+    #define GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG 0x8C02
+#endif
+#ifndef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+    #define GL_COMPRESSED_RGBA_ASTC_4x4_KHR     0x93b0
+#endif
+#ifndef GL_COMPRESSED_RGBA_ASTC_8x8_KHR
+    #define GL_COMPRESSED_RGBA_ASTC_8x8_KHR     0x93b7
+#endif
 
-    //GL_MAX_TEXTURE_IMAGE_UNITS
-    //GL_MAX_VIEWPORT_DIMS
+#ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
+    #define GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT   0x84FF
+#endif
 
-    //int numAuxBuffers;
-    //glGetIntegerv(GL_AUX_BUFFERS, &numAuxBuffers);
-    //TraceLog(LOG_INFO, "GL_AUX_BUFFERS: %i", numAuxBuffers);
+#ifndef GL_TEXTURE_MAX_ANISOTROPY_EXT
+    #define GL_TEXTURE_MAX_ANISOTROPY_EXT       0x84FE
+#endif
 
-    //GLint numComp = 0;
-    //GLint format[32] = { 0 };
-    //glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &numComp);
-    //glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, format);
-    //for (int i = 0; i < numComp; i++) TraceLog(LOG_INFO, "Supported compressed format: 0x%x", format[i]);
+#if defined(GRAPHICS_API_OPENGL_11)
+    #define GL_UNSIGNED_SHORT_5_6_5             0x8363
+    #define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
+    #define GL_UNSIGNED_SHORT_4_4_4_4           0x8033
+#endif
 
-    // NOTE: We don't need that much data on screen... right now...
+#if defined(GRAPHICS_API_OPENGL_21)
+    #define GL_LUMINANCE                        0x1909
+    #define GL_LUMINANCE_ALPHA                  0x190A
+#endif
 
-    // TODO: Automatize extensions loading using rlLoadExtensions() and GLAD
-    // Actually, when rlglInit() is called in InitWindow() in core.c,
-    // OpenGL required extensions have already been loaded (PLATFORM_DESKTOP)
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    #define glClearDepth                glClearDepthf
+    #define GL_READ_FRAMEBUFFER         GL_FRAMEBUFFER
+    #define GL_DRAW_FRAMEBUFFER         GL_FRAMEBUFFER
+    #define GL_TIMESTAMP                GL_TIMESTAMP_EXT
+    #define GL_QUERY_RESULT             GL_QUERY_RESULT_EXT
+    #define GL_QUERY_RESULT_AVAILABLE   GL_QUERY_RESULT_AVAILABLE_EXT
+    #define GL_PROGRAM_BINARY_LENGTH    GL_PROGRAM_BINARY_LENGTH_OES
+    #define GL_NUM_PROGRAM_BINARY_FORMATS GL_NUM_PROGRAM_BINARY_FORMATS_OES
+
+    // NOTE: Instancing extensions function types, not declared by some OpenGL ES 2.0 headers (ANGLE)
+    #ifndef GL_EXT_draw_instanced
+        typedef void (GL_APIENTRYP PFNGLDRAWARRAYSINSTANCEDEXTPROC) (GLenum mode, GLint start, GLsizei count, GLsizei primcount);
+    #endif
+    #ifndef GL_EXT_instanced_arrays
+        typedef void (GL_APIENTRYP PFNGLVERTEXATTRIBDIVISOREXTPROC) (GLuint index, GLuint divisor);
+    #endif
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Get supported extensions list
-    GLint numExt = 0;
+    // NOTE: Timer queries extension defines and function types, not declared by some OpenGL ES 2.0 headers (ANGLE)
+    #ifndef GL_TIMESTAMP_EXT
+        #define GL_TIMESTAMP_EXT        0x8E28
+    #endif
+    #ifndef GL_GPU_DISJOINT_EXT
+        #define GL_GPU_DISJOINT_EXT     0x8FBB
+    #endif
+    #ifndef GL_EXT_disjoint_timer_query
+        typedef void (GL_APIENTRYP PFNGLQUERYCOUNTEREXTPROC) (GLuint id, GLenum target);
+        typedef void (GL_APIENTRYP PFNGLGETQUERYOBJECTIVEXTPROC) (GLuint id, GLenum pname, GLint *params);
+        typedef void (GL_APIENTRYP PFNGLGETQUERYOBJECTUI64VEXTPROC) (GLuint id, GLenum pname, GLuint64 *params);
+    #endif
+#endif
 
-#if defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: On OpenGL 3.3 VAO and NPOT are supported by default
-    vaoSupported = true;
+// Default vertex attribute names on shader to set location points
+#define DEFAULT_ATTRIB_POSITION_NAME    "vertexPosition"    // shader-location = 0
+#define DEFAULT_ATTRIB_TEXCOORD_NAME    "vertexTexCoord"    // shader-location = 1
+#define DEFAULT_ATTRIB_NORMAL_NAME      "vertexNormal"      // shader-location = 2
+#define DEFAULT_ATTRIB_COLOR_NAME       "vertexColor"       // shader-location = 3
+#define DEFAULT_ATTRIB_TANGENT_NAME     "vertexTangent"     // shader-location = 4
+#define DEFAULT_ATTRIB_TEXCOORD2_NAME   "vertexTexCoord2"   // shader-location = 5
+#define DEFAULT_ATTRIB_TEXSLOT_NAME     "vertexTexSlot"     // shader-location = 6
+#define DEFAULT_ATTRIBS_COUNT           7
 
-    // Multiple texture extensions supported by default
-    texNPOTSupported = true;
-    texFloatSupported = true;
-    texDepthSupported = true;
+// Batch flush reasons, registered on frame statistics
+#define FLUSH_REASON_STATE_CHANGE       0       // rlglDraw() requested (state change, end of frame)
+#define FLUSH_REASON_BUFFER_LIMIT       1       // Batch buffer limit reached
+#define FLUSH_REASON_DRAWCALL_LIMIT     2       // Batch draw calls limit reached
 
-    // We get a list of available extensions and we check for some of them (compressed textures)
-    // NOTE: We don't need to check again supported extensions but we do (GLAD already dealt with that)
-    glGetIntegerv(GL_NUM_EXTENSIONS, &numExt);
+// Pixel buffer objects used for asynchronous texture updates (ring, reused once GPU is done with them)
+#define MAX_TEXTURE_UPLOAD_BUFFERS      3
 
-    // Allocate numExt strings pointers
-    const char **extList = RL_MALLOC(sizeof(const char *)*numExt);
+// Screen readbacks in flight (rlReadScreenPixelsAsync()), delivered in request order
+#define MAX_SCREEN_READBACKS            3
 
-    // Get extensions strings
-    for (int i = 0; i < numExt; i++) extList[i] = (const char *)glGetStringi(GL_EXTENSIONS, i);
+// GPU timers: frames in flight (results latency) and timestamp queries per frame (begin/end pairs)
+#define MAX_GPU_TIMER_FRAMES            4
+#define MAX_GPU_TIMER_QUERIES         256
 
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    // Allocate 512 strings pointers (2 KB)
-    const char **extList = RL_MALLOC(sizeof(const char *)*512);
+// GL state cache: texture units and shader programs (built-in uniforms values) tracked
+#define MAX_STATE_TEXTURE_UNITS        16
+#define MAX_STATE_PROGRAMS             32
 
-    const char *extensions = (const char *)glGetString(GL_EXTENSIONS);  // One big const string
+// GL state cache: built-in uniforms uploaded flags
+#define STATE_UNIFORM_MVP               1
+#define STATE_UNIFORM_COLOR             2
+#define STATE_UNIFORM_SAMPLER           4
 
-    // NOTE: We have to duplicate string because glGetString() returns a const string
-    int len = strlen(extensions) + 1;
-    char *extensionsDup = (char *)RL_CALLOC(len, sizeof(char));
-    strcpy(extensionsDup, extensions);
+// Shader uniforms cache: uniform name length and staged value size limits (larger uniforms are uploaded directly)
+#define MAX_UNIFORM_NAME_LENGTH        64
+#define MAX_UNIFORM_VALUE_SIZE         64
 
-    extList[numExt] = extensionsDup;
+// Shader uniforms cache: staged value data type for matrix 4x4 (next to ShaderUniformDataType)
+#define UNIFORM_MATRIX                100
 
-    for (int i = 0; i < len; i++)
-    {
-        if (extensionsDup[i] == ' ')
-        {
-            extensionsDup[i] = '\0';
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
 
-            numExt++;
-            extList[numExt] = &extensionsDup[i + 1];
-        }
-    }
+// Batch vertex data, interleaved (24 bytes per vertex)
+// NOTE: Position (shader-location = 0), texcoords (shader-location = 1) and color (shader-location = 3),
+// same layout than rlQuadVertex, so vertex data can be directly copied into the batch
+typedef rlQuadVertex BatchVertex;
 
-    // NOTE: Duplicated string (extensionsDup) must be deallocated
+// Dynamic vertex buffers (interleaved vertex data + indices arrays)
+typedef struct DynamicBuffer {
+    int vCounter;               // vertex counter to process (and draw) from full buffer
+    BatchVertex *vertices;      // vertex data (position + texcoords + colors), uploaded with a single call
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    unsigned int *indices;      // vertex indices (in case vertex data comes indexed) (6 indices per quad)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned short *indices;    // vertex indices (in case vertex data comes indexed) (6 indices per quad)
+                                // NOTE: 6*2 byte = 12 byte, not alignment problem!
 #endif
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[2];      // OpenGL Vertex Buffer Objects id (interleaved vertex data + indices)
+    BatchVertex *mappedVertices;    // Persistently mapped vertex buffer (only if buffer storage is supported)
+    void *fence;                // Fence sync object, signaled when GPU has finished drawing this buffer
+} DynamicBuffer;
 
-    TraceLog(LOG_INFO, "Number of supported extensions: %i", numExt);
+// Draw call type
+typedef struct DrawCall {
+    int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
+    int vertexCount;            // Number of vertex of the draw
+    int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
+    //unsigned int vaoId;         // Vertex array id to be used on the draw
+    unsigned int textures[MAX_BATCH_TEXTURES];  // Texture ids to be used on the draw (one per texture unit)
+    int texturesCount;          // Number of textures used on the draw (only one with custom shaders)
+    Shader shader;              // Shader to be used on the draw (program id and locations)
+    int blendMode;              // Blending mode to be used on the draw
+    bool scissorEnabled;        // Scissor test enabled for the draw
+    int scissorRec[4];          // Scissor rectangle for the draw (x, y, width, height), bottom-left origin
+    int layer;                  // Draw layer, draws are ordered by layer on rlglDraw()
+    bool opaque;                // Draw is opaque, depth is written (only set on depth sort mode)
 
-    // Show supported extensions
-    //for (int i = 0; i < numExt; i++)  TraceLog(LOG_INFO, "Supported extension: %s", extList[i]);
+    //Matrix projection;        // Projection matrix for this draw
+    //Matrix modelview;         // Modelview matrix for this draw
+} DrawCall;
 
-    // Check required extensions
-    for (int i = 0; i < numExt; i++)
-    {
-#if defined(GRAPHICS_API_OPENGL_ES2)
-        // Check VAO support
-        // NOTE: Only check on OpenGL ES, OpenGL 3.3 has VAO support as core feature
-        if (strcmp(extList[i], (const char *)"GL_OES_vertex_array_object") == 0)
-        {
-            // The extension is supported by our hardware and driver, try to get related functions pointers
-            // NOTE: emscripten does not support VAOs natively, it uses emulation and it reduces overall performance...
-            glGenVertexArrays = (PFNGLGENVERTEXARRAYSOESPROC)eglGetProcAddress("glGenVertexArraysOES");
-            glBindVertexArray = (PFNGLBINDVERTEXARRAYOESPROC)eglGetProcAddress("glBindVertexArrayOES");
-            glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSOESPROC)eglGetProcAddress("glDeleteVertexArraysOES");
-            //glIsVertexArray = (PFNGLISVERTEXARRAYOESPROC)eglGetProcAddress("glIsVertexArrayOES");     // NOTE: Fails in WebGL, omitted
+// Static batch draw call
+typedef struct StaticDraw {
+    int mode;                   // Drawing mode: LINES, TRIANGLES (quads are converted to triangles)
+    int vertexOffset;           // First vertex of the draw
+    int vertexCount;            // Number of vertex of the draw
+    unsigned int textures[MAX_BATCH_TEXTURES];  // Texture ids to be used on the draw (one per texture unit)
+    int texturesCount;          // Number of textures used on the draw
+    Shader shader;              // Shader to be used on the draw
+    int blendMode;              // Blending mode to be used on the draw
+} StaticDraw;
+
+// Static batch: captured vertex data and draw calls, replayed from a static GPU buffer
+typedef struct StaticBatch {
+    bool active;                // Static batch slot in use
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId;         // OpenGL Vertex Buffer Object id (interleaved vertex data)
+    BatchVertex *vertices;      // Captured vertex data (freed once uploaded, kept on software backend)
+    int vertexCount;            // Captured vertex count
+    int vertexCapacity;         // Captured vertex data capacity
+    StaticDraw *draws;          // Captured draw calls
+    int drawsCount;             // Captured draw calls count
+    int drawsCapacity;          // Captured draw calls capacity
+} StaticBatch;
+
+// Texture upload buffer: pixel buffer object used as source of asynchronous texture updates
+typedef struct TextureUploadBuffer {
+    unsigned int pboId;         // OpenGL Pixel Buffer Object id
+    int size;                   // Buffer size in bytes
+    void *fence;                // Fence sync signaled once GPU is done reading the buffer
+} TextureUploadBuffer;
+
+// Screen readback: pixel buffer object screen pixels are read into, mapped once GPU is done
+typedef struct ScreenReadback {
+    unsigned int pboId;         // OpenGL Pixel Buffer Object id
+    int size;                   // Buffer size in bytes
+    int width;                  // Readback width
+    int height;                 // Readback height
+    unsigned char *pixels;      // Pixels read synchronously (fallback if pixel buffers not supported)
+    void *fence;                // Fence sync signaled once GPU has written the buffer
+} ScreenReadback;
+
+// GPU timer frame: timestamp queries registered along a frame, resolved a few frames later
+typedef struct GpuTimerFrame {
+    unsigned int queries[MAX_GPU_TIMER_QUERIES];    // Timestamp queries, begin/end pair per section
+    int types[MAX_GPU_TIMER_QUERIES/2];             // Section timer type (-1 if section not ended)
+    int sectionsCount;          // Sections registered
+    int lastQuery;              // Last query submitted (frame results available once it is)
+    unsigned int frameIndex;    // Frame number (latency computation)
+    bool pending;               // Frame submitted, results not resolved yet
+} GpuTimerFrame;
+
+// GL state cache: currently bound objects, state changes are only issued if they change something
+// NOTE: Unknown state is registered as -1, so next change is always issued
+typedef struct GlState {
+    unsigned int program;       // Shader program in use
+    unsigned int vaoId;         // Vertex array object bound
+    int activeTexture;          // Active texture unit
+    unsigned int textures[MAX_STATE_TEXTURE_UNITS];     // 2D texture bound per texture unit
+    int blendMode;              // Blending mode set
+} GlState;
+
+// GL state cache: built-in uniforms values uploaded to a shader program (uniforms values are program state)
+typedef struct ProgramState {
+    unsigned int id;            // Shader program id (0 if slot not used)
+    unsigned int valid;         // Uploaded values flags (STATE_UNIFORM_*)
+    float mvp[16];              // Uploaded MVP matrix (LOC_MATRIX_MVP)
+    float colDiffuse[4];        // Uploaded diffuse color (LOC_COLOR_DIFFUSE)
+    int mapDiffuse;             // Uploaded diffuse texture unit (LOC_MAP_DIFFUSE)
+} ProgramState;
+
+// Shader uniform, active uniform registered on shader uniforms cache
+typedef struct ShaderUniform {
+    char name[MAX_UNIFORM_NAME_LENGTH];     // Uniform name (arrays without [0] suffix)
+    unsigned int hash;          // Uniform name hash (FNV-1a)
+    int location;               // Uniform location
+    int type;                   // Staged value data type (ShaderUniformDataType or UNIFORM_MATRIX)
+    int count;                  // Staged value elements count
+    bool dirty;                 // Staged value pending to be uploaded
+    bool uploaded;              // Staged value already uploaded (program uniform value known)
+    float value[MAX_UNIFORM_VALUE_SIZE/sizeof(float)];  // Staged value data (int values stored as is)
+} ShaderUniform;
+
+// Shader uniforms cache, active uniforms are registered on shader load
+// NOTE: Uniform values are staged by SetShaderValue*() and uploaded once on next draw using the shader,
+// caches are kept by rlgl (registered by program id), Shader copies never hold a pointer to them
+typedef struct ShaderUniforms {
+    unsigned int program;       // Shader program id (0 if cache slot is free)
+    ShaderUniform *uniforms;    // Active uniforms
+    int uniformsCount;          // Active uniforms count
+    int *nameTable;             // Uniforms hash table by name (uniform index + 1, 0 if empty)
+    int *locationTable;         // Uniforms hash table by location (uniform index + 1, 0 if empty)
+    int tableSize;              // Hash tables size (power of two)
+    int *dirty;                 // Uniforms with staged values pending to be uploaded (indices)
+    int dirtyCount;             // Uniforms pending to be uploaded count
+} ShaderUniforms;
+
+// Transform run: consecutive batch vertex transformed by the same matrix
+// NOTE: Vertex are transformed on rlglDraw(), all runs at once
+typedef struct TransformRun {
+    int start;                  // First vertex of the run (in current buffer)
+    int count;                  // Number of vertex in the run
+    unsigned int version;       // Transform matrix version when run was registered
+    Matrix matrix;              // Transform matrix to apply
+} TransformRun;
 
-            if ((glGenVertexArrays != NULL) && (glBindVertexArray != NULL) && (glDeleteVertexArrays != NULL)) vaoSupported = true;
-        }
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Matrix stack[MAX_MATRIX_STACK_SIZE] = { 0 };
+static int stackCounter = 0;
 
-        // Check NPOT textures support
-        // NOTE: Only check on OpenGL ES, OpenGL 3.3 has NPOT textures full support as core feature
-        if (strcmp(extList[i], (const char *)"GL_OES_texture_npot") == 0) texNPOTSupported = true;
+static Matrix modelview = { 0 };
+static Matrix projection = { 0 };
+static Matrix *currentMatrix = NULL;
+static int currentMatrixMode = -1;
+static float currentDepth = -1.0f;
 
-        // Check texture float support
-        if (strcmp(extList[i], (const char *)"GL_OES_texture_float") == 0) texFloatSupported = true;
+// Default dynamic buffer for elements data
+// NOTE: A multi-buffering system is supported, buffers are used as a ring,
+// GPU buffers are persistently mapped and fence-synced if supported, orphaned otherwise
+static DynamicBuffer vertexData[MAX_BATCH_BUFFERING] = { 0 };
+static int currentBuffer = 0;
+static int batchElements = MAX_BATCH_ELEMENTS;      // Batch elements (quads) limit per buffer
+static int batchDrawCalls = MAX_DRAWCALL_REGISTERED;    // Batch draw calls limit
+static bool batchGrowth = false;            // Batch buffers grow automatically when limits are reached
+static int fenceWaitCounter = 0;            // Number of times CPU waited on a buffer fence
+
+// Deferred mode: draw calls sharing state are merged on rlglDraw(), preserving painter's order
+static bool deferredMode = false;
+static BatchVertex *mergeVertices = NULL;   // Vertex data reordered by merged draw calls (swapped with current buffer)
+static int drawsRegisteredCounter = 0;      // Draw calls registered (not empty), reset with rlResetFrameStats()
+static int drawsSubmittedCounter = 0;       // Draw calls submitted to GPU, reset with rlResetFrameStats()
+
+// Draw calls merge/sort scratch arrays, sized to batch draw calls limit (only reallocated when limit grows)
+static int *drawsWork = NULL;               // Per draw call work integers (5 per draw call)
+static float *drawsBounds = NULL;           // Per draw call and per group screen-space bounds (8 floats per draw call)
+static DrawCall *drawsSorted = NULL;        // Sorted draw calls
+static int drawsScratchCapacity = 0;
+
+// Draw layers: draw calls are ordered by layer on rlglDraw(), painter's order is kept inside a layer
+static int currentLayer = 0;                // Current draw layer, registered per draw call
+static int layerDepthSteps[MAX_BATCH_LAYERS] = { 0 };   // Primitives depth steps per layer (depth sort mode), reset when depth buffer is cleared
+static bool depthSortMode = false;          // Opaque draws front-to-back with depth test, translucent draws back-to-front
+static bool depthTestEnabled = false;       // Depth test enabled by rlEnableDepthTest(), restored after depth sorted draws
+static unsigned char *textureOpaque = NULL; // Texture opaque flags, indexed by texture id (unknown textures are translucent)
+static unsigned int textureOpaqueCapacity = 0;  // Texture opaque flags capacity
+
+// Current vertex attributes, applied to every new vertex on rlVertex3f()
+static float currentTexcoord[2] = { 0.0f, 0.0f };
+static unsigned char currentColor[4] = { 255, 255, 255, 255 };
+static unsigned char currentTexSlot = 0;    // Current texture slot (index on current draw call textures)
+static bool texturePending = false;         // Texture enabled for next rlBegin()/rlEnd(), kept on draw mode change
+static int defaultTexSlotLoc = -1;          // Default shader texture slot attribute location
 
-        // Check depth texture support
-        if ((strcmp(extList[i], (const char *)"GL_OES_depth_texture") == 0) ||
-            (strcmp(extList[i], (const char *)"GL_WEBGL_depth_texture") == 0)) texDepthSupported = true;
+// Transform matrix to be used with rlTranslate, rlRotate, rlScale
+static Matrix transformMatrix = { 0 };
+static bool useTransformMatrix = false;
+static unsigned int transformVersion = 0;   // Incremented on every matrix change, identifies transform runs matrix
 
-        if (strcmp(extList[i], (const char *)"GL_OES_depth24") == 0) maxDepthBits = 24;
-        if (strcmp(extList[i], (const char *)"GL_OES_depth32") == 0) maxDepthBits = 32;
+// Transform runs registered for current buffer, applied on rlglDraw()
+static TransformRun *transformRuns = NULL;
+static int transformRunsCounter = 0;
+static int transformRunsCapacity = 0;
+static bool simdTransformVerified = false;  // SIMD transform kernel verified bit-exact with Vector3Transform()
+
+// Renderer frame statistics and next flush reason
+static rlFrameStats frameStats = { 0 };
+static int flushReason = FLUSH_REASON_STATE_CHANGE;
+
+// Asynchronous texture updates, pixel buffer objects ring
+// NOTE: Only available on OpenGL 3.3, OpenGL ES 2.0 always updates textures synchronously
+#if defined(GRAPHICS_API_OPENGL_33)
+static TextureUploadBuffer uploadBuffers[MAX_TEXTURE_UPLOAD_BUFFERS] = { 0 };
+static int currentUploadBuffer = 0;         // Next upload buffer to use
 #endif
-        // DDS texture compression support
-        if ((strcmp(extList[i], (const char *)"GL_EXT_texture_compression_s3tc") == 0) ||
-            (strcmp(extList[i], (const char *)"GL_WEBGL_compressed_texture_s3tc") == 0) ||
-            (strcmp(extList[i], (const char *)"GL_WEBKIT_WEBGL_compressed_texture_s3tc") == 0)) texCompDXTSupported = true;
+static bool pixelBufferSupported = false;   // Buffer mapping and fence sync support (OpenGL 3.0/3.2 or extensions)
+
+// GPU timer queries, frames in flight ring (oldest frame slot is reused on new frame)
+static GpuTimerFrame gpuTimerFrames[MAX_GPU_TIMER_FRAMES] = { 0 };
+static int gpuTimerFrame = -1;              // Current timed frame slot (-1 if no frame being timed)
+static int gpuTimerNext = 0;                // Next frame slot to use
+static unsigned int gpuTimerFramesCounter = 0;          // Timed frames counter
+static int gpuTimerDepth[RL_GPU_TIMER_COUNT] = { 0 };    // Sections nesting depth per timer type
+static int gpuTimerSection[RL_GPU_TIMER_COUNT] = { 0 };  // Open section index per timer type (-1 if not registered)
+static rlGpuTimings gpuTimings = { 0 };     // Last resolved frame timings
+static bool gpuTimersSupported = false;     // Timestamp queries support (OpenGL 3.3 or EXT_disjoint_timer_query)
+static bool gpuTimersEnabled = false;       // GPU timers enabled (rlEnableGpuTimers())
+static bool gpuTimersLoaded = false;        // Query objects generated
+
+// GL state cache (shadow state), redundant state changes and uniform uploads are skipped
+static GlState glState = { 0 };
+static ProgramState programStates[MAX_STATE_PROGRAMS] = { 0 };
+static int programStatesNext = 0;           // Next program state slot to reuse (if no free slot)
+
+// Shader uniforms caches, registered by shader program id (slots are reused)
+static ShaderUniforms *shaderUniforms = NULL;
+static int shaderUniformsCounter = 0;
+
+// Static batches, id is index + 1
+static StaticBatch *staticBatches = NULL;
+static int staticBatchesCounter = 0;
+static int staticBatchCapture = 0;          // Static batch being captured (id), 0 if none
 
-        // ETC1 texture compression support
-        if ((strcmp(extList[i], (const char *)"GL_OES_compressed_ETC1_RGB8_texture") == 0) ||
-            (strcmp(extList[i], (const char *)"GL_WEBGL_compressed_texture_etc1") == 0)) texCompETC1Supported = true;
+// Default buffers draw calls
+static DrawCall *draws = NULL;
+static int drawsCounter = 0;
 
-        // ETC2/EAC texture compression support
-        if (strcmp(extList[i], (const char *)"GL_ARB_ES3_compatibility") == 0) texCompETC2Supported = true;
+// Scissor state, registered on every new draw call along with current shader and blending mode
+static bool scissorEnabled = false;
+static int scissorRec[4] = { 0 };
 
-        // PVR texture compression support
-        if (strcmp(extList[i], (const char *)"GL_IMG_texture_compression_pvrtc") == 0) texCompPVRTSupported = true;
+// Quads culling against scissor rectangle, screen-space transform is only computed when matrices change
+static int currentViewport[4] = { 0 };      // Current viewport (x, y, width, height)
+static Matrix cullMatrix = { 0 };           // Culling transform: transform matrix (if used), modelview and projection
+static unsigned int cullVersion = 0;        // Transform version of culling transform
+static bool cullValid = false;              // Culling transform computed (with or without transform matrix)
+static bool cullTransform = false;          // Culling transform includes transform matrix
 
-        // ASTC texture compression support
-        if (strcmp(extList[i], (const char *)"GL_KHR_texture_compression_astc_hdr") == 0) texCompASTCSupported = true;
+// View culling: visible area bounds are computed from culling transform (only for 2D affine transforms)
+static bool viewCulling = false;            // View culling enabled (rlSetViewCulling())
+static bool viewBoundsValid = false;        // Visible area bounds computed for current culling transform
+static float viewBounds[4] = { 0 };         // Visible area bounds in current transform space (xmin, ymin, xmax, ymax)
 
-        // Anisotropic texture filter support
-        if (strcmp(extList[i], (const char *)"GL_EXT_texture_filter_anisotropic") == 0)
-        {
-            texAnisotropicFilterSupported = true;
-            glGetFloatv(0x84FF, &maxAnisotropicLevel);   // GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
-        }
+// Default texture (1px white) useful for plain color polys (required by shader)
+static unsigned int defaultTextureId = 0;
 
-        // Clamp mirror wrap mode supported
-        if (strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) texMirrorClampSupported = true;
+// Default shaders
+static unsigned int defaultVShaderId = 0;   // Default vertex shader id (used by default shader program)
+static unsigned int defaultFShaderId = 0;   // Default fragment shader Id (used by default shader program)
+static const char *defaultVShaderCode = NULL;   // Default vertex shader code (used by shader cache)
+static const char *defaultFShaderCode = NULL;   // Default fragment shader code (used by shader cache)
 
-        // Debug marker support
-        if (strcmp(extList[i], (const char *)"GL_EXT_debug_marker") == 0) debugMarkerSupported = true;
-    }
+// Default vertex attributes binded on shader program linkage, attribute location is array index
+// NOTE: Binding layout is part of shader cache key, program binaries keep attributes locations
+static const char *defaultAttribNames[DEFAULT_ATTRIBS_COUNT] = {
+    DEFAULT_ATTRIB_POSITION_NAME, DEFAULT_ATTRIB_TEXCOORD_NAME, DEFAULT_ATTRIB_NORMAL_NAME, DEFAULT_ATTRIB_COLOR_NAME,
+    DEFAULT_ATTRIB_TANGENT_NAME, DEFAULT_ATTRIB_TEXCOORD2_NAME, DEFAULT_ATTRIB_TEXSLOT_NAME
+};
 
-    // Free extensions pointers
-    RL_FREE(extList);
+static Shader defaultShader = { 0 };        // Basic shader, support vertex color and diffuse texture
+static Shader currentShader = { 0 };        // Shader to be used on rendering (by default, defaultShader)
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    RL_FREE(extensionsDup);    // Duplicated string must be deallocated
+// Shader program binaries cache
+static char shaderCachePath[512] = { 0 };   // Shader cache directory, cache disabled if empty (SetShaderCachePath())
+static bool programBinarySupported = false; // Program binaries support (OpenGL 4.1, ARB_get_program_binary or OES_get_program_binary)
 
-    if (vaoSupported) TraceLog(LOG_INFO, "[EXTENSION] VAO extension detected, VAO functions initialized successfully");
-    else TraceLog(LOG_WARNING, "[EXTENSION] VAO extension not found, VAO usage not supported");
+// Extension supported flag: VAO
+static bool vaoSupported = false;           // VAO support (OpenGL ES2 could not support VAO extension)
 
-    if (texNPOTSupported) TraceLog(LOG_INFO, "[EXTENSION] NPOT textures extension detected, full NPOT textures supported");
-    else TraceLog(LOG_WARNING, "[EXTENSION] NPOT textures extension not found, limited NPOT support (no-mipmaps, no-repeat)");
-#endif
+// Extension supported flag: Compressed textures
+static bool texCompDXTSupported = false;    // DDS texture compression support
+static bool texCompETC1Supported = false;   // ETC1 texture compression support
+static bool texCompETC2Supported = false;   // ETC2/EAC texture compression support
+static bool texCompPVRTSupported = false;   // PVR texture compression support
+static bool texCompASTCSupported = false;   // ASTC texture compression support
 
-    if (texCompDXTSupported) TraceLog(LOG_INFO, "[EXTENSION] DXT compressed textures supported");
-    if (texCompETC1Supported) TraceLog(LOG_INFO, "[EXTENSION] ETC1 compressed textures supported");
-    if (texCompETC2Supported) TraceLog(LOG_INFO, "[EXTENSION] ETC2/EAC compressed textures supported");
-    if (texCompPVRTSupported) TraceLog(LOG_INFO, "[EXTENSION] PVRT compressed textures supported");
-    if (texCompASTCSupported) TraceLog(LOG_INFO, "[EXTENSION] ASTC compressed textures supported");
+// Extension supported flag: Textures format
+static bool texNPOTSupported = false;       // NPOT textures full support
+static bool texFloatSupported = false;      // float textures support (32 bit per channel)
+static bool texDepthSupported = false;      // Depth textures supported
+static int maxDepthBits = 16;               // Maximum bits for depth component
 
-    if (texAnisotropicFilterSupported) TraceLog(LOG_INFO, "[EXTENSION] Anisotropic textures filtering supported (max: %.0fX)", maxAnisotropicLevel);
-    if (texMirrorClampSupported) TraceLog(LOG_INFO, "[EXTENSION] Mirror clamp wrap texture mode supported");
+// Extension supported flag: Clamp mirror wrap mode
+static bool texMirrorClampSupported = false;        // Clamp mirror wrap mode supported
 
-    if (debugMarkerSupported) TraceLog(LOG_INFO, "[EXTENSION] Debug Marker supported");
+// Extension supported flag: Anisotropic filtering
+static bool texAnisotropicFilterSupported = false;  // Anisotropic texture filtering support
+static float maxAnisotropicLevel = 0.0f;            // Maximum anisotropy level supported (minimum is 2.0f)
 
-    // Initialize buffers, default shaders and default textures
-    //----------------------------------------------------------
-    // Init default white texture
-    unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
-    defaultTextureId = rlLoadTexture(pixels, 1, 1, UNCOMPRESSED_R8G8B8A8, 1);
+static bool debugMarkerSupported = false;   // Debug marker support
 
-    if (defaultTextureId != 0) TraceLog(LOG_INFO, "[TEX ID %i] Base white texture loaded successfully", defaultTextureId);
-    else TraceLog(LOG_WARNING, "Base white texture could not be loaded");
+// Extension supported flag: Persistent mapped buffers (OpenGL 4.4 or ARB_buffer_storage)
+static bool bufferStorageSupported = false; // Buffer storage and fence sync support
 
-    // Init default Shader (customized for GL 3.3 and ES2)
-    defaultShader = LoadShaderDefault();
-    currentShader = defaultShader;
+// Extension supported flag: Instancing (OpenGL 3.3 or ES2 instanced arrays extensions)
+static bool instancingSupported = false;    // Instanced arrays support (glVertexAttribDivisor, glDrawArraysInstanced)
 
-    // Init default vertex arrays buffers
-    LoadBuffersDefault();
+// Sprite instancing: shader and buffers
+static Shader instanceShader = { 0 };       // Sprite instancing shader (uses default fragment shader)
+static int instanceTextureSizeLoc = -1;     // Sprite instancing shader texture size uniform location
+static unsigned int instanceVaoId = 0;      // Sprite instancing VAO
+static unsigned int instanceVboId[2] = { 0 };   // Sprite instancing VBOs: quad corners, instances data
+static int instanceBufferCapacity = 0;      // Sprite instancing buffer size (in instances)
 
-    // Init transformations matrix accumulator
-    transformMatrix = MatrixIdentity();
+// Stereo rendering: eyes views, batch is drawn in a single pass if eyes viewports are side by side (OpenGL 3.3)
+static bool stereoRender = false;           // Stereo rendering enabled (rlEnableStereoRender())
+static Matrix stereoProjection[2] = { 0 };  // Eyes projection matrices
+static Matrix stereoViewOffset[2] = { 0 };  // Eyes view offset matrices
+static int stereoViewport[2][4] = { 0 };    // Eyes viewports [x, y, width, height]
+static Shader stereoShader = { 0 };         // Batch shader stereo variant, both eyes drawn by one instanced draw
 
-    // Init draw calls tracking system
-    draws = (DrawCall *)RL_MALLOC(sizeof(DrawCall)*MAX_DRAWCALL_REGISTERED);
+#if defined(GRAPHICS_API_OPENGL_ES2)
+// NOTE: VAO functionality is exposed through extensions (OES)
+static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays;
+static PFNGLBINDVERTEXARRAYOESPROC glBindVertexArray;
+static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays;
+//static PFNGLISVERTEXARRAYOESPROC glIsVertexArray;   // NOTE: Fails in WebGL, omitted
 
-    for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
-    {
-        draws[i].mode = RL_QUADS;
-        draws[i].vertexCount = 0;
-        draws[i].vertexAlignment = 0;
-        //draws[i].vaoId = 0;
-        //draws[i].shaderId = 0;
-        draws[i].textureId = defaultTextureId;
-        //draws[i].projection = MatrixIdentity();
-        //draws[i].modelview = MatrixIdentity();
-    }
+// NOTE: Instancing functionality is exposed through extensions (ANGLE, EXT, NV)
+static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced;
+static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor;
 
-    drawsCounter = 1;
+// NOTE: Timer queries functionality is exposed through extension (EXT_disjoint_timer_query)
+static PFNGLGENQUERIESEXTPROC glGenQueries;
+static PFNGLDELETEQUERIESEXTPROC glDeleteQueries;
+static PFNGLQUERYCOUNTEREXTPROC glQueryCounter;
+static PFNGLGETQUERYOBJECTIVEXTPROC glGetQueryObjectiv;
+static PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64v;
 
-    // Init internal matrix stack (emulating OpenGL 1.1)
-    for (int i = 0; i < MAX_MATRIX_STACK_SIZE; i++) stack[i] = MatrixIdentity();
+// NOTE: Program binaries functionality is exposed through extension (OES_get_program_binary)
+static PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary;
+static PFNGLPROGRAMBINARYOESPROC glProgramBinary;
+#endif
 
-    // Init internal projection and modelview matrices
-    projection = MatrixIdentity();
-    modelview = MatrixIdentity();
-    currentMatrix = &modelview;
-#endif      // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
-    // Initialize OpenGL default states
-    //----------------------------------------------------------
-    // Init state: Depth test
-    glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+static int blendMode = 0;                   // Track current blending mode
 
-    // Init state: Blending mode
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+// Scissor rectangles stack, every pushed rectangle is intersected with previous one (bottom-left origin)
+static int scissorStack[MAX_SCISSOR_STACK_SIZE][4] = { 0 };
+static int scissorStackCounter = 0;
 
-    // Init state: Culling
-    // NOTE: All shapes/models triangles are drawn CCW
-    glCullFace(GL_BACK);                                    // Cull the back face (default)
-    glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+// Asynchronous screen readbacks, pixel buffer objects ring (FIFO)
+static ScreenReadback screenReadbacks[MAX_SCREEN_READBACKS] = { 0 };
+static int screenReadbackFirst = 0;         // Oldest readback requested
+static int screenReadbacksCounter = 0;      // Readbacks requested and not retrieved yet
 
-#if defined(GRAPHICS_API_OPENGL_11)
-    // Init state: Color hints (deprecated in OpenGL 3.0+)
-    glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_NICEST);      // Improve quality of color and texture coordinate interpolation
-    glShadeModel(GL_SMOOTH);                                // Smooth shading between vertex (vertex colors interpolation)
+// Default framebuffer size
+static int framebufferWidth = 0;            // Default framebuffer width
+static int framebufferHeight = 0;           // Default framebuffer height
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static void SetBlendMode(int mode);         // Set OpenGL blending function for a blending mode
+static bool SetStateTexture(int unit, unsigned int id);     // Bind 2D texture to texture unit (skipped if already bound)
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static unsigned int CompileShader(const char *shaderStr, int type);     // Compile custom shader and return shader id
+static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId);  // Load custom shader program
+static const char *GetShaderCacheFilePath(const char *vsCode, const char *fsCode);      // Get shader cache file path (hash of shaders code and driver)
+static unsigned int LoadShaderProgramBinary(const char *fileName);                  // Load shader program from cached program binary
+static void SaveShaderProgramBinary(unsigned int program, const char *fileName);    // Save shader program binary to cache
+
+static Shader LoadShaderDefault(void);      // Load default shader (just vertex positioning and texture coloring)
+static void SetShaderDefaultLocations(Shader *shader); // Bind default shader locations (attributes and uniforms)
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+static Shader LoadShaderStereo(unsigned int fShaderId); // Load batch shader stereo variant (single pass stereo rendering)
 #endif
+static void SetStereoEye(int eye, Matrix matModelView);     // Set stereo eye viewport and matrices (one pass per eye)
+static void ResetStereoViewport(void);      // Set viewport covering both stereo eyes
+static void LoadShaderUniforms(unsigned int program);               // Load shader active uniforms cache (locations by name)
+static void UnloadShaderUniforms(unsigned int program);             // Unload shader uniforms cache
+static ShaderUniforms *GetShaderUniforms(unsigned int program);     // Get shader uniforms cache (NULL if not loaded)
+static unsigned int HashUniformName(const char *name);              // Get uniform name hash (FNV-1a)
+static ShaderUniform *GetShaderUniform(ShaderUniforms *uniforms, const char *name, int location);  // Get cached uniform by name (or location)
+static void SetShaderUniform(Shader shader, int location, const void *value, int type, int count);  // Stage shader uniform value (skipped if not changed)
+static void UploadShaderUniform(int location, const void *value, int type, int count);  // Upload uniform value to shader program in use
+static void FlushShaderUniforms(Shader shader);     // Upload shader staged uniform values
+static bool CheckShaderPending(unsigned int id);    // Check shader is used by batch draw calls not drawn yet
+
+static void SetStateProgram(unsigned int id);       // Use shader program (skipped if already in use)
+static void SetStateVertexArray(unsigned int id);   // Bind vertex array object (skipped if already bound)
+static void SetStateActiveTexture(int unit);        // Set active texture unit (skipped if already active)
+static ProgramState *GetProgramState(unsigned int id);  // Get shader program built-in uniforms state (registered if not tracked)
+static void SetStateUniformMvp(Shader shader, Matrix mvp);  // Upload shader MVP matrix (skipped if already uploaded)
+static void SetStateUniformColor(Shader shader, float r, float g, float b, float a); // Upload shader diffuse color (skipped if already uploaded)
+static void SetStateUniformSampler(Shader shader, int unit);    // Upload shader diffuse sampler unit (skipped if already uploaded)
+static void ResetStateUniform(Shader shader, int uniformLoc);   // Invalidate built-in uniform value uploaded outside state cache
+static void ResetStateObject(unsigned int textureId, unsigned int programId, unsigned int vaoId);  // Forget deleted objects (OpenGL unbinds them)
+static void UnloadShaderDefault(void);      // Unload default shader
 
-    // Init state: Color/Depth buffers clear
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);                   // Set clear color (black)
-    glClearDepth(1.0f);                                     // Set clear depth value (default)
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear color and depth buffers (depth buffer required for 3D)
+static void LoadBuffersDefault(void);       // Load default internal buffers
+static void UpdateBuffersDefault(void);     // Update default internal buffers (VAOs/VBOs) with vertex data
+static void SetBufferAttribsDefault(void);  // Set default internal buffers vertex attributes (interleaved layout)
+static void DrawBuffersDefault(void);       // Draw default internal buffers vertex data
+static void UnloadBuffersDefault(void);     // Unload default internal buffers vertex data from CPU and GPU
+static void NewDrawCall(void);              // Close current draw call (if not empty) and register current draw state
+static void MergeDrawCalls(void);           // Merge compatible draw calls and reorder vertex data (deferred mode)
+static void ResetDrawCalls(int start);      // Reset draw calls from start index, using current draw state
+static void SortDrawCalls(bool depthSort);  // Sort draw calls by layer and reorder vertex data (opaque draws first on depth sort)
+static void CheckDrawsScratch(void);        // Check draw calls scratch arrays fit batch draw calls limit (grow if required)
+static bool CheckDrawOpaque(const DrawCall *draw, const BatchVertex *vertices);   // Check draw call is opaque (alpha blending, opaque textures and colors)
+static float GetBaseDepth(void);            // Get depth for new primitives (current layer depth on depth sort mode)
+static void NextPrimitiveDepth(void);       // Advance depth for next primitive, following primitives are drawn on top
+static bool CheckPixelsOpaque(const void *data, int width, int height, int format);   // Check pixel data is opaque (NULL data only checks format)
+static bool IsTextureOpaque(unsigned int id);   // Check texture is registered as opaque
+static void SetTextureOpaque(unsigned int id, bool opaque);     // Register texture opaque flag
+static bool GrowBuffersDefault(int vCount); // Grow default internal buffers to fit some additional vertex
+static bool CheckQuadScissorCulled(const BatchVertex *vertices);    // Check quad is fully outside current scissor rectangle
+static void UpdateCullMatrix(void);         // Update culling transform and visible area bounds (only if matrices changed)
+
+static void AddTransformRun(int start, int count);  // Register vertex to be transformed by current transform matrix
+static void ApplyTransformRuns(void);       // Transform registered vertex runs (on rlglDraw())
+static void TransformVertices(BatchVertex *vertices, int count, Matrix mat, bool simd);   // Transform vertex positions by a matrix
+static bool CheckTransformKernel(void);     // Check SIMD transform kernel is bit-exact with Vector3Transform()
+
+#if defined(GRAPHICS_API_NONE)
+static void RecordBatchFlush(Matrix mvp);   // Record current batch vertex data and draw calls (record backend, rasterized on software backend)
+#endif
 
-    // Store screen size into global variables
-    framebufferWidth = width;
-    framebufferHeight = height;
+static void LoadInstancing(void);           // Load sprite instancing shader and buffers
+static void UnloadInstancing(void);         // Unload sprite instancing shader and buffers
 
-    TraceLog(LOG_INFO, "OpenGL default states initialized successfully");
-}
+static void CaptureStaticBatch(void);       // Capture current buffer vertex data and draw calls into static batch being captured
 
-// Vertex Buffer Object deinitialization (memory free)
-void rlglClose(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    UnloadShaderDefault();              // Unload default shader
-    UnloadBuffersDefault();             // Unload default buffers
-    glDeleteTextures(1, &defaultTextureId); // Unload default texture
+static void BeginGpuTimerFrame(void);       // Begin GPU timer frame, reusing oldest frame slot
+static bool ResolveGpuTimerFrame(GpuTimerFrame *frame); // Resolve GPU timer frame results (only if available)
 
-    TraceLog(LOG_INFO, "[TEX ID %i] Unloaded texture data (base white texture) from VRAM", defaultTextureId);
+static void GenDrawCube(void);              // Generate and draw cube
+static void GenDrawQuad(void);              // Generate and draw quad
 
-    RL_FREE(draws);
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
+#if defined(GRAPHICS_API_OPENGL_11)
+static int GenerateMipmaps(unsigned char *data, int baseWidth, int baseHeight);
+static Color *GenNextMipmap(Color *srcData, int srcWidth, int srcHeight);
 #endif
-}
 
-// Update and draw internal buffers
-void rlglDraw(void)
+static void FlipPixelsOpaque(unsigned char *dst, const unsigned char *src, int width, int height);  // Flip RGBA pixels vertically setting alpha to 255 (in place if dst == src)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Matrix operations
+//----------------------------------------------------------------------------------
+
+#if defined(GRAPHICS_API_OPENGL_11)
+
+// Fallback to OpenGL 1.1 function calls
+//---------------------------------------
+void rlMatrixMode(int mode)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Only process data if we have data to process
-    if (vertexData[currentBuffer].vCounter > 0)
+    switch (mode)
     {
-        UpdateBuffersDefault();
-        DrawBuffersDefault();       // NOTE: Stereo rendering is checked inside
+        case RL_PROJECTION: glMatrixMode(GL_PROJECTION); break;
+        case RL_MODELVIEW: glMatrixMode(GL_MODELVIEW); break;
+        case RL_TEXTURE: glMatrixMode(GL_TEXTURE); break;
+        default: break;
     }
-#endif
 }
 
-// Returns current OpenGL version
-int rlGetVersion(void)
+void rlFrustum(double left, double right, double bottom, double top, double znear, double zfar)
 {
-#if defined(GRAPHICS_API_OPENGL_11)
-    return OPENGL_11;
-#elif defined(GRAPHICS_API_OPENGL_21)
-    #if defined(__APPLE__)
-        return OPENGL_33;       // NOTE: Force OpenGL 3.3 on OSX
-    #else
-        return OPENGL_21;
-    #endif
-#elif defined(GRAPHICS_API_OPENGL_33)
-    return OPENGL_33;
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    return OPENGL_ES_20;
-#endif
+    glFrustum(left, right, bottom, top, znear, zfar);
 }
 
-// Check internal buffer overflow for a given number of vertex
-bool rlCheckBufferLimit(int vCount)
+void rlOrtho(double left, double right, double bottom, double top, double znear, double zfar)
 {
-    bool overflow = false;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((vertexData[currentBuffer].vCounter + vCount) >= (MAX_BATCH_ELEMENTS*4)) overflow = true;
-#endif
-    return overflow;
+    glOrtho(left, right, bottom, top, znear, zfar);
 }
 
-// Set debug marker
-void rlSetDebugMarker(const char *text)
-{
-#if defined(GRAPHICS_API_OPENGL_33)
-    if (debugMarkerSupported) glInsertEventMarkerEXT(0, text);
-#endif
-}
+void rlPushMatrix(void) { glPushMatrix(); }
+void rlPopMatrix(void) { glPopMatrix(); }
+void rlLoadIdentity(void) { glLoadIdentity(); }
+void rlTranslatef(float x, float y, float z) { glTranslatef(x, y, z); }
+void rlRotatef(float angleDeg, float x, float y, float z) { glRotatef(angleDeg, x, y, z); }
+void rlScalef(float x, float y, float z) { glScalef(x, y, z); }
+void rlMultMatrixf(float *matf) { glMultMatrixf(matf); }
 
-// Load OpenGL extensions
-// NOTE: External loader function could be passed as a pointer
-void rlLoadExtensions(void *loader)
-{
-#if defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
-    #if !defined(__APPLE__)
-        if (!gladLoadGLLoader((GLADloadproc)loader)) TraceLog(LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
-        else TraceLog(LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
+#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 
-        #if defined(GRAPHICS_API_OPENGL_21)
-        if (GLAD_GL_VERSION_2_1) TraceLog(LOG_INFO, "OpenGL 2.1 profile supported");
-        #elif defined(GRAPHICS_API_OPENGL_33)
-        if (GLAD_GL_VERSION_3_3) TraceLog(LOG_INFO, "OpenGL 3.3 Core profile supported");
-        else TraceLog(LOG_ERROR, "OpenGL 3.3 Core profile not supported");
-        #endif
-    #endif
+// Choose the current matrix to be transformed
+void rlMatrixMode(int mode)
+{
+    if (mode == RL_PROJECTION) currentMatrix = &projection;
+    else if (mode == RL_MODELVIEW) currentMatrix = &modelview;
+    //else if (mode == RL_TEXTURE) // Not supported
 
-    // With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
-    //if (GLAD_GL_ARB_vertex_array_object) // Use GL_ARB_vertex_array_object
-#endif
+    currentMatrixMode = mode;
 }
 
-// Get world coordinates from screen coordinates
-Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view)
+// Push the current matrix into stack
+void rlPushMatrix(void)
 {
-    Vector3 result = { 0.0f, 0.0f, 0.0f };
-
-    // Calculate unproject matrix (multiply view patrix by projection matrix) and invert it
-    Matrix matViewProj = MatrixMultiply(view, proj);
-    matViewProj = MatrixInvert(matViewProj);
-
-    // Create quaternion from source point
-    Quaternion quat = { source.x, source.y, source.z, 1.0f };
-
-    // Multiply quat point by unproject matrix
-    quat = QuaternionTransform(quat, matViewProj);
+    if (stackCounter >= MAX_MATRIX_STACK_SIZE) TraceLog(LOG_ERROR, "Matrix stack overflow");
 
-    // Normalized world points in vectors
-    result.x = quat.x/quat.w;
-    result.y = quat.y/quat.w;
-    result.z = quat.z/quat.w;
+    if (currentMatrixMode == RL_MODELVIEW)
+    {
+        useTransformMatrix = true;
+        currentMatrix = &transformMatrix;
+    }
 
-    return result;
+    stack[stackCounter] = *currentMatrix;
+    stackCounter++;
 }
 
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+// Pop lattest inserted matrix from stack
+void rlPopMatrix(void)
 {
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
-
-    unsigned int id = 0;
-
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= COMPRESSED_DXT1_RGB)
-    {
-        TraceLog(LOG_WARNING, "OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!texCompDXTSupported) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
-        (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA)))
-    {
-        TraceLog(LOG_WARNING, "DXT compressed texture format not supported");
-        return id;
-    }
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!texCompETC1Supported) && (format == COMPRESSED_ETC1_RGB))
+    if (stackCounter > 0)
     {
-        TraceLog(LOG_WARNING, "ETC1 compressed texture format not supported");
-        return id;
+        Matrix mat = stack[stackCounter - 1];
+        *currentMatrix = mat;
+        stackCounter--;
+        transformVersion++;
     }
 
-    if ((!texCompETC2Supported) && ((format == COMPRESSED_ETC2_RGB) || (format == COMPRESSED_ETC2_EAC_RGBA)))
+    if ((stackCounter == 0) && (currentMatrixMode == RL_MODELVIEW))
     {
-        TraceLog(LOG_WARNING, "ETC2 compressed texture format not supported");
-        return id;
+        currentMatrix = &modelview;
+        useTransformMatrix = false;
     }
+}
 
-    if ((!texCompPVRTSupported) && ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)))
-    {
-        TraceLog(LOG_WARNING, "PVRT compressed texture format not supported");
-        return id;
-    }
+// Reset current matrix to identity matrix
+void rlLoadIdentity(void)
+{
+    *currentMatrix = MatrixIdentity();
+    transformVersion++;
+}
 
-    if ((!texCompASTCSupported) && ((format == COMPRESSED_ASTC_4x4_RGBA) || (format == COMPRESSED_ASTC_8x8_RGBA)))
-    {
-        TraceLog(LOG_WARNING, "ASTC compressed texture format not supported");
-        return id;
-    }
-#endif
-#endif      // GRAPHICS_API_OPENGL_11
+// Multiply the current matrix by a translation matrix
+void rlTranslatef(float x, float y, float z)
+{
+    Matrix matTranslation = MatrixTranslate(x, y, z);
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    // NOTE: We transpose matrix with multiplication order
+    *currentMatrix = MatrixMultiply(matTranslation, *currentMatrix);
+    transformVersion++;
+}
 
-    glGenTextures(1, &id);              // Generate texture id
+// Multiply the current matrix by a rotation matrix
+void rlRotatef(float angleDeg, float x, float y, float z)
+{
+    Matrix matRotation = MatrixIdentity();
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    //glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
-#endif
+    Vector3 axis = (Vector3){ x, y, z };
+    matRotation = MatrixRotate(Vector3Normalize(axis), angleDeg*DEG2RAD);
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    // NOTE: We transpose matrix with multiplication order
+    *currentMatrix = MatrixMultiply(matRotation, *currentMatrix);
+    transformVersion++;
+}
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset
+// Multiply the current matrix by a scaling matrix
+void rlScalef(float x, float y, float z)
+{
+    Matrix matScale = MatrixScale(x, y, z);
 
-    TraceLog(LOG_DEBUG, "Load texture from data memory address: 0x%x", data);
+    // NOTE: We transpose matrix with multiplication order
+    *currentMatrix = MatrixMultiply(matScale, *currentMatrix);
+    transformVersion++;
+}
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
-    {
-        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+// Multiply the current matrix by another matrix
+void rlMultMatrixf(float *matf)
+{
+    // Matrix creation from array
+    Matrix mat = { matf[0], matf[4], matf[8], matf[12],
+                   matf[1], matf[5], matf[9], matf[13],
+                   matf[2], matf[6], matf[10], matf[14],
+                   matf[3], matf[7], matf[11], matf[15] };
 
-        unsigned int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    *currentMatrix = MatrixMultiply(*currentMatrix, mat);
+    transformVersion++;
+}
 
-        TraceLog(LOG_DEBUG, "Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+// Multiply the current matrix by a perspective matrix generated by parameters
+void rlFrustum(double left, double right, double bottom, double top, double znear, double zfar)
+{
+    Matrix matPerps = MatrixFrustum(left, right, bottom, top, znear, zfar);
 
-        if (glInternalFormat != -1)
-        {
-            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
-        #if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
-        #endif
+    *currentMatrix = MatrixMultiply(*currentMatrix, matPerps);
+    transformVersion++;
+}
 
-        #if defined(GRAPHICS_API_OPENGL_33)
-            if (format == UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == UNCOMPRESSED_GRAY_ALPHA)
-            {
-            #if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-            #elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-            #endif
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-        #endif
-        }
+// Multiply the current matrix by an orthographic matrix generated by parameters
+void rlOrtho(double left, double right, double bottom, double top, double znear, double zfar)
+{
+    Matrix matOrtho = MatrixOrtho(left, right, bottom, top, znear, zfar);
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;
+    *currentMatrix = MatrixMultiply(*currentMatrix, matOrtho);
+    transformVersion++;
+}
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
-    }
+#endif
 
-    // Texture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
-    if (texNPOTSupported)
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-    }
-    else
-    {
-        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
-    }
-#else
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+// Set the viewport area (transformation from normalized device coordinates to window coordinates)
+// NOTE: Updates global variables: framebufferWidth, framebufferHeight
+void rlViewport(int x, int y, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    currentViewport[0] = x;
+    currentViewport[1] = y;
+    currentViewport[2] = width;
+    currentViewport[3] = height;
 #endif
+    glViewport(x, y, width, height);
+}
 
-    // Magnification and minification filters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vertex level operations
+//----------------------------------------------------------------------------------
+#if defined(GRAPHICS_API_OPENGL_11)
 
-#if defined(GRAPHICS_API_OPENGL_33)
-    if (mipmapCount > 1)
+// Fallback to OpenGL 1.1 function calls
+//---------------------------------------
+void rlBegin(int mode)
+{
+    switch (mode)
     {
-        // Activate Trilinear filtering if mipmaps are available
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        case RL_LINES: glBegin(GL_LINES); break;
+        case RL_TRIANGLES: glBegin(GL_TRIANGLES); break;
+        case RL_QUADS: glBegin(GL_QUADS); break;
+        default: break;
     }
-#endif
+}
 
-    // At this point we have the texture loaded in GPU and texture parameters configured
+void rlEnd() { glEnd(); }
+void rlVertex2i(int x, int y) { glVertex2i(x, y); }
+void rlVertex2f(float x, float y) { glVertex2f(x, y); }
+void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
+void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
+void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
+void rlColor4ub(byte r, byte g, byte b, byte a) { glColor4ub(r, g, b, a); }
+void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
+void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
 
-    // NOTE: If mipmaps were not in data, they are not generated automatically
+#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+// Initialize drawing mode (how to organize vertex)
+void rlBegin(int mode)
+{
+    // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
+    // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
+    if (draws[drawsCounter - 1].mode != mode)
+    {
+        // NOTE: New draw uses default texture, unless a texture was enabled for this rlBegin()/rlEnd()
+        unsigned int textureId = texturePending? draws[drawsCounter - 1].textures[currentTexSlot] : defaultTextureId;
 
-    if (id > 0) TraceLog(LOG_INFO, "[TEX ID %i] Texture created successfully (%ix%i - %i mipmaps)", id, width, height, mipmapCount);
-    else TraceLog(LOG_WARNING, "Texture could not be created");
+        NewDrawCall();
 
-    return id;
+        draws[drawsCounter - 1].mode = mode;
+        draws[drawsCounter - 1].textures[0] = textureId;
+        draws[drawsCounter - 1].texturesCount = 1;
+        currentTexSlot = 0;
+    }
 }
 
-// Load depth texture/renderbuffer (to be attached to fbo)
-// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
-unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer)
+// Finish vertex providing
+void rlEnd(void)
 {
-    unsigned int id = 0;
+    // NOTE: Texcoords and colors are stored along with every vertex on rlVertex3f(),
+    // using the latest values provided, so vertex data is always complete at this point
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int glInternalFormat = GL_DEPTH_COMPONENT16;
+    // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
+    // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
+    // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
+    // NOTE: On depth sort mode depth advances inside draw layer depth range, painter's order is kept by depth test (GL_LEQUAL)
+    NextPrimitiveDepth();
 
-    if ((bits != 16) && (bits != 24) && (bits != 32)) bits = 16;
+    texturePending = false;
 
-    if (bits == 24)
+    // Verify internal buffers limits
+    // NOTE: This check is combined with usage of rlCheckBufferLimit()
+    // NOTE: If batch growth is enabled, batch is only drawn if buffers could not grow (16bit indices on OpenGL ES 2.0)
+    if (((vertexData[currentBuffer].vCounter) >= (batchElements*4 - 4)) && (!batchGrowth || !GrowBuffersDefault(4)))
     {
-#if defined(GRAPHICS_API_OPENGL_33)
-        glInternalFormat = GL_DEPTH_COMPONENT24;
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        if (maxDepthBits >= 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
-#endif
+        // WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a rlglDraw(),
+        // we need to call rlPopMatrix() before to recover *currentMatrix (modelview) for the next forced draw call!
+        // If we have multiple matrix pushed, it will require "stackCounter" pops before launching the draw
+        frameStats.matrixPops += (stackCounter + 1);
+        for (int i = stackCounter; i >= 0; i--) rlPopMatrix();
+
+        flushReason = FLUSH_REASON_BUFFER_LIMIT;
+        rlglDraw();
     }
+}
 
-    if (bits == 32)
+// Define one vertex (position)
+// NOTE: Vertex position data is the basic information required for drawing
+// NOTE: If transform matrix is in use, vertex is registered on a transform run and transformed on rlglDraw()
+void rlVertex3f(float x, float y, float z)
+{
+    // Verify that batch elements limit not reached (or grow buffers if enabled)
+    // NOTE: Checked when a primitive starts, if buffers could not grow to fit it (16bit indices on OpenGL ES 2.0)
+    // batch is drawn keeping current draw mode and texture, primitives are never split between batches
+    if (batchGrowth && ((vertexData[currentBuffer].vCounter + 4) > (batchElements*4)))
     {
-#if defined(GRAPHICS_API_OPENGL_33)
-        glInternalFormat = GL_DEPTH_COMPONENT32;
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        if (maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
-#endif
+        DrawCall *draw = &draws[drawsCounter - 1];
+        int primitiveSize = (draw->mode == RL_LINES)? 2 : (draw->mode == RL_TRIANGLES)? 3 : 4;
+
+        if (((draw->vertexCount%primitiveSize) == 0) && ((vertexData[currentBuffer].vCounter + primitiveSize) > (batchElements*4)) &&
+            !GrowBuffersDefault(primitiveSize))
+        {
+            int mode = draw->mode;
+            unsigned int textureId = draw->textures[currentTexSlot];
+
+            flushReason = FLUSH_REASON_BUFFER_LIMIT;
+            rlglDraw();
+
+            rlEnableTexture(textureId);
+            rlBegin(mode);
+        }
     }
 
-    if (!useRenderBuffer && texDepthSupported)
+    if (vertexData[currentBuffer].vCounter < (batchElements*4))
     {
-        glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+        BatchVertex *vertex = &vertexData[currentBuffer].vertices[vertexData[currentBuffer].vCounter];
+
+        vertex->x = x;
+        vertex->y = y;
+        vertex->z = z;
+        vertex->u = currentTexcoord[0];
+        vertex->v = currentTexcoord[1];
+        vertex->r = currentColor[0];
+        vertex->g = currentColor[1];
+        vertex->b = currentColor[2];
+        vertex->a = currentColor[3];
+        vertex->slot = currentTexSlot;
+
+        if (useTransformMatrix)
+        {
+            // Extend current transform run if possible (same matrix and contiguous vertex)
+            TransformRun *run = (transformRunsCounter > 0)? &transformRuns[transformRunsCounter - 1] : NULL;
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            if ((run != NULL) && (run->version == transformVersion) && ((run->start + run->count) == vertexData[currentBuffer].vCounter)) run->count++;
+            else AddTransformRun(vertexData[currentBuffer].vCounter, 1);
+        }
 
-        glBindTexture(GL_TEXTURE_2D, 0);
-    }
-    else
-    {
-        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
-        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
-        glGenRenderbuffers(1, &id);
-        glBindRenderbuffer(GL_RENDERBUFFER, id);
-        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+        vertexData[currentBuffer].vCounter++;
 
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
-    }
-#endif
+        draws[drawsCounter - 1].vertexCount++;
 
-    return id;
-}
+        // Quads fully outside scissor rectangle are culled (removed from batch) as soon as they are completed
+        // NOTE: Not checked on stereo rendering (eyes use their own viewports) or static batch capture (drawn later with a transform)
+        if (scissorEnabled && !stereoRender && (staticBatchCapture == 0) && (draws[drawsCounter - 1].mode == RL_QUADS) && ((draws[drawsCounter - 1].vertexCount%4) == 0) &&
+            CheckQuadScissorCulled(&vertexData[currentBuffer].vertices[vertexData[currentBuffer].vCounter - 4]))
+        {
+            int vCounter = vertexData[currentBuffer].vCounter - 4;
 
-// Load texture cubemap
-// NOTE: Cubemap data is expected to be 6 images in a single column,
-// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
-unsigned int rlLoadTextureCubemap(void *data, int size, int format)
-{
-    unsigned int cubemapId = 0;
-    unsigned int dataSize = GetPixelDataSize(size, size, format);
+            vertexData[currentBuffer].vCounter = vCounter;
+            draws[drawsCounter - 1].vertexCount -= 4;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenTextures(1, &cubemapId);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapId);
+            // Trim transform runs covering removed vertex
+            while ((transformRunsCounter > 0) && (transformRuns[transformRunsCounter - 1].start >= vCounter)) transformRunsCounter--;
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+            TransformRun *run = (transformRunsCounter > 0)? &transformRuns[transformRunsCounter - 1] : NULL;
+            if ((run != NULL) && ((run->start + run->count) > vCounter)) run->count = vCounter - run->start;
 
-    if (glInternalFormat != -1)
-    {
-        // Load cubemap faces
-        for (unsigned int i = 0; i < 6; i++)
-        {
-            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
-#if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
-#endif
-#if defined(GRAPHICS_API_OPENGL_33)
-            if (format == UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-#endif
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-#endif
+            frameStats.quadsCulled++;
         }
     }
-
-    // Set cubemap texture sampling parameters
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
-#endif
-
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-#endif
-
-    return cubemapId;
+    else TraceLog(LOG_ERROR, "Batch elements overflow (%i elements), use rlSetBatchLimits()", batchElements);
 }
 
-// Update already loaded texture in GPU with new data
-// NOTE: We don't know safely if internal texture format is the expected one...
-void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data)
+// Define one vertex (position)
+void rlVertex2f(float x, float y)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlVertex3f(x, y, currentDepth);
+}
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+// Define one vertex (position)
+void rlVertex2i(int x, int y)
+{
+    rlVertex3f((float)x, (float)y, currentDepth);
+}
 
-    if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
-    {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glFormat, glType, (unsigned char *)data);
-    }
-    else TraceLog(LOG_WARNING, "Texture format updating not supported");
+// Define one vertex (texture coordinate)
+// NOTE: Texture coordinates are limited to QUADS only
+// NOTE: Value is stored and applied to the following rlVertex3f() calls
+void rlTexCoord2f(float x, float y)
+{
+    currentTexcoord[0] = x;
+    currentTexcoord[1] = y;
 }
 
-// Get OpenGL internal formats and data type from raylib PixelFormat
-void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+// Define one vertex (normal)
+// NOTE: Normals limited to TRIANGLES only?
+void rlNormal3f(float x, float y, float z)
 {
-    *glInternalFormat = -1;
-    *glFormat = -1;
-    *glType = -1;
+    // TODO: Normals usage...
+}
 
-    switch (format)
-    {
-    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
-        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
-        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        #if !defined(GRAPHICS_API_OPENGL_11)
-        case UNCOMPRESSED_R32: if (texFloatSupported) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
-        case UNCOMPRESSED_R32G32B32: if (texFloatSupported) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
-        case UNCOMPRESSED_R32G32B32A32: if (texFloatSupported) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
-        #endif
-    #elif defined(GRAPHICS_API_OPENGL_33)
-        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R32: if (texFloatSupported) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
-        case UNCOMPRESSED_R32G32B32: if (texFloatSupported) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case UNCOMPRESSED_R32G32B32A32: if (texFloatSupported) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-    #endif
-        #if !defined(GRAPHICS_API_OPENGL_11)
-        case COMPRESSED_DXT1_RGB: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
-        case COMPRESSED_DXT1_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
-        case COMPRESSED_DXT3_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
-        case COMPRESSED_DXT5_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-        case COMPRESSED_ETC1_RGB: if (texCompETC1Supported) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
-        case COMPRESSED_ETC2_RGB: if (texCompETC2Supported) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case COMPRESSED_ETC2_EAC_RGBA: if (texCompETC2Supported) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case COMPRESSED_PVRT_RGB: if (texCompPVRTSupported) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
-        case COMPRESSED_PVRT_RGBA: if (texCompPVRTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
-        case COMPRESSED_ASTC_4x4_RGBA: if (texCompASTCSupported) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        case COMPRESSED_ASTC_8x8_RGBA: if (texCompASTCSupported) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        #endif
-        default: TraceLog(LOG_WARNING, "Texture format not supported"); break;
-    }
+// Define one vertex (color)
+// NOTE: Value is stored and applied to the following rlVertex3f() calls
+void rlColor4ub(byte x, byte y, byte z, byte w)
+{
+    currentColor[0] = x;
+    currentColor[1] = y;
+    currentColor[2] = z;
+    currentColor[3] = w;
 }
 
-// Unload texture from GPU memory
-void rlUnloadTexture(unsigned int id)
+// Define one vertex (color)
+void rlColor4f(float r, float g, float b, float a)
 {
-    if (id > 0) glDeleteTextures(1, &id);
+    rlColor4ub((byte)(r*255), (byte)(g*255), (byte)(b*255), (byte)(a*255));
 }
 
-// Load a texture to be used for rendering (fbo with default color and depth attachments)
-// NOTE: If colorFormat or depthBits are no supported, no attachment is done
-RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture)
+// Define one vertex (color)
+void rlColor3f(float x, float y, float z)
 {
-    RenderTexture2D target = { 0 };
+    rlColor4ub((byte)(x*255), (byte)(y*255), (byte)(z*255), 255);
+}
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (useDepthTexture && texDepthSupported) target.depthTexture = true;
+#endif
 
-    // Create the framebuffer object
-    glGenFramebuffers(1, &target.id);
-    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+// Push multiple quads vertex data (4 vertex per quad, RL_QUADS order) using a texture
+// NOTE: On batched backends, vertex data is copied into the batch with a single capacity check
+void rlPushQuads(const rlQuadVertex *vertices, int count, unsigned int textureId)
+{
+    if (count <= 0) return;
 
-    // Create fbo color texture attachment
-    //-----------------------------------------------------------------------------------------------------
-    if ((format != -1) && (format < COMPRESSED_DXT1_RGB))
+#if defined(GRAPHICS_API_OPENGL_11)
+    rlEnableTexture(textureId);
+    glBegin(GL_QUADS);
+
+    for (int i = 0; i < 4*count; i++)
     {
-        // WARNING: Some texture formats are not supported for fbo color attachment
-        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = format;
-        target.texture.mipmaps = 1;
+        glColor4ub(vertices[i].r, vertices[i].g, vertices[i].b, vertices[i].a);
+        glTexCoord2f(vertices[i].u, vertices[i].v);
+        glVertex3f(vertices[i].x, vertices[i].y, vertices[i].z);
     }
-    //-----------------------------------------------------------------------------------------------------
 
-    // Create fbo depth renderbuffer/texture
-    //-----------------------------------------------------------------------------------------------------
-    if (depthBits > 0)
+    glEnd();
+    rlDisableTexture();
+#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Quads that do not fit in an empty batch are pushed in several batches, unless buffers can grow to fit them
+    // NOTE: Some extra vertex are reserved for current draw call alignment, growth could fail (16bit indices on OpenGL ES 2.0)
+    if ((count > (batchElements - 2)) && (!batchGrowth || !GrowBuffersDefault(4*count + 4)))
     {
-        target.depth.id = rlLoadTextureDepth(width, height, depthBits, !useDepthTexture);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
+        rlPushQuads(vertices, batchElements - 2, textureId);
+        rlPushQuads(vertices + 4*(batchElements - 2), count - (batchElements - 2), textureId);
+        return;
     }
-    //-----------------------------------------------------------------------------------------------------
-
-    // Attach color texture and depth renderbuffer to FBO
-    //-----------------------------------------------------------------------------------------------------
-    rlRenderTextureAttach(target, target.texture.id, 0);    // COLOR attachment
-    rlRenderTextureAttach(target, target.depth.id, 1);      // DEPTH attachment
-    //-----------------------------------------------------------------------------------------------------
 
-    // Check if fbo is complete with attachments (valid)
-    //-----------------------------------------------------------------------------------------------------
-    if (rlRenderTextureComplete(target)) TraceLog(LOG_INFO, "[FBO ID %i] Framebuffer object created successfully", target.id);
-    //-----------------------------------------------------------------------------------------------------
+    if (rlCheckBufferLimit(4*count + 4)) rlglDraw();
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-#endif
+    rlEnableTexture(textureId);
+    rlBegin(RL_QUADS);
 
-    return target;
-}
+    BatchVertex *batch = &vertexData[currentBuffer].vertices[vertexData[currentBuffer].vCounter];
+    memcpy(batch, vertices, sizeof(BatchVertex)*4*count);
 
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
-void rlRenderTextureAttach(RenderTexture2D target, unsigned int id, int attachType)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+    // Set vertex texture slot for current draw call
+    for (int i = 0; i < 4*count; i++) batch[i].slot = currentTexSlot;
+    texturePending = false;
 
-    if (attachType == 0) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
-    else if (attachType == 1)
+    // Quads fully outside scissor rectangle are culled (compacted out of batch vertex data)
+    if (scissorEnabled && !stereoRender && (staticBatchCapture == 0))
     {
-        if (target.depthTexture) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, id, 0);
-        else glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, id);
+        int kept = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (CheckQuadScissorCulled(&batch[4*i])) continue;
+
+            if (kept != i) memcpy(&batch[4*kept], &batch[4*i], sizeof(BatchVertex)*4);
+            kept++;
+        }
+
+        frameStats.quadsCulled += (count - kept);
+        count = kept;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // Register provided vertex to be transformed on rlglDraw() if required
+    if (useTransformMatrix && (count > 0)) AddTransformRun(vertexData[currentBuffer].vCounter, 4*count);
+
+    vertexData[currentBuffer].vCounter += 4*count;
+    draws[drawsCounter - 1].vertexCount += 4*count;
+
+    // NOTE: Same depth increment than rlEnd(), following vertex are drawn on top
+    NextPrimitiveDepth();
 #endif
 }
 
-// Verify render texture is complete
-bool rlRenderTextureComplete(RenderTexture target)
+//----------------------------------------------------------------------------------
+// Module Functions Definition - OpenGL equivalent functions (common to 1.1, 3.3+, ES2)
+//----------------------------------------------------------------------------------
+
+// Enable texture usage
+void rlEnableTexture(unsigned int id)
 {
-    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_11)
+    glEnable(GL_TEXTURE_2D);
+    SetStateTexture(0, id);
+#endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+    // NOTE: Texture is added to current draw call textures if possible (one texture unit per texture),
+    // vertex keep the texture slot, only default shader supports multiple textures per draw call
+    DrawCall *draw = &draws[drawsCounter - 1];
+    int maxTextures = (draw->shader.id == defaultShader.id)? MAX_BATCH_TEXTURES : 1;
+    int slot = -1;
 
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    for (int i = 0; i < draw->texturesCount; i++)
+    {
+        if (draw->textures[i] == id) { slot = i; break; }
+    }
 
-    if (status != GL_FRAMEBUFFER_COMPLETE)
+    if (slot == -1)
     {
-        switch (status)
+        if (draw->texturesCount < maxTextures)
         {
-            case GL_FRAMEBUFFER_UNSUPPORTED: TraceLog(LOG_WARNING, "Framebuffer is unsupported"); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TraceLog(LOG_WARNING, "Framebuffer has incomplete attachment"); break;
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TraceLog(LOG_WARNING, "Framebuffer has incomplete dimensions"); break;
-#endif
-            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TraceLog(LOG_WARNING, "Framebuffer has a missing attachment"); break;
-            default: break;
+            slot = draw->texturesCount;
+            draw->textures[slot] = id;
+            draw->texturesCount++;
         }
-    }
+        else
+        {
+            NewDrawCall();
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            draws[drawsCounter - 1].textures[0] = id;
+            draws[drawsCounter - 1].texturesCount = 1;
+            slot = 0;
+        }
+    }
 
-    result = (status == GL_FRAMEBUFFER_COMPLETE);
+    currentTexSlot = (unsigned char)slot;
+    texturePending = true;
 #endif
-
-    return result;
 }
 
-// Generate mipmap data for selected texture
-void rlGenerateMipmaps(Texture2D *texture)
+// Disable texture usage
+void rlDisableTexture(void)
 {
-    glBindTexture(GL_TEXTURE_2D, texture->id);
+#if defined(GRAPHICS_API_OPENGL_11)
+    glDisable(GL_TEXTURE_2D);
+    SetStateTexture(0, 0);
+#else
+    texturePending = false;
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+    // NOTE: If quads batch limit is reached,
+    // we force a draw call and next batch starts
+    if (!batchGrowth && (vertexData[currentBuffer].vCounter >= (batchElements*4)))
+    {
+        flushReason = FLUSH_REASON_BUFFER_LIMIT;
+        rlglDraw();
+    }
+#endif
+}
 
-    if (((texture->width > 0) && ((texture->width & (texture->width - 1)) == 0)) &&
-        ((texture->height > 0) && ((texture->height & (texture->height - 1)) == 0))) texIsPOT = true;
+// Set texture parameters (wrap mode/filter mode)
+void rlTextureParameters(unsigned int id, int param, int value)
+{
+    SetStateTexture(0, id);
 
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (texIsPOT)
+    switch (param)
     {
-        // WARNING: Manual mipmap generation only works for RGBA 32bit textures!
-        if (texture->format == UNCOMPRESSED_R8G8B8A8)
+        case RL_TEXTURE_WRAP_S:
+        case RL_TEXTURE_WRAP_T:
         {
-            // Retrieve texture data from VRAM
-            void *data = rlReadTexturePixels(*texture);
-
-            // NOTE: data size is reallocated to fit mipmaps data
-            // NOTE: CPU mipmap generation only supports RGBA 32bit data
-            int mipmapCount = GenerateMipmaps(data, texture->width, texture->height);
-
-            int size = texture->width*texture->height*4;
-            int offset = size;
-
-            int mipWidth = texture->width/2;
-            int mipHeight = texture->height/2;
-
-            // Load the mipmaps
-            for (int level = 1; level < mipmapCount; level++)
+            if (value == RL_WRAP_MIRROR_CLAMP)
             {
-                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mipWidth, mipHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char *)data + offset);
-
-                size = mipWidth*mipHeight*4;
-                offset += size;
-
-                mipWidth /= 2;
-                mipHeight /= 2;
+#if !defined(GRAPHICS_API_OPENGL_11)
+                if (texMirrorClampSupported) glTexParameteri(GL_TEXTURE_2D, param, value);
+                else TraceLog(LOG_WARNING, "Clamp mirror wrap mode not supported");
+#endif
             }
+            else glTexParameteri(GL_TEXTURE_2D, param, value);
 
-            texture->mipmaps = mipmapCount + 1;
-            RL_FREE(data); // Once mipmaps have been generated and data has been uploaded to GPU VRAM, we can discard RAM data
-
-            TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps [%i] generated manually on CPU side", texture->id, texture->mipmaps);
-        }
-        else TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps could not be generated for texture format", texture->id);
+        } break;
+        case RL_TEXTURE_MAG_FILTER:
+        case RL_TEXTURE_MIN_FILTER: glTexParameteri(GL_TEXTURE_2D, param, value); break;
+        case RL_TEXTURE_ANISOTROPIC_FILTER:
+        {
+#if !defined(GRAPHICS_API_OPENGL_11)
+            if (value <= maxAnisotropicLevel) glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
+            else if (maxAnisotropicLevel > 0.0f)
+            {
+                TraceLog(LOG_WARNING, "[TEX ID %i] Maximum anisotropic filter level supported is %iX", id, maxAnisotropicLevel);
+                glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
+            }
+            else TraceLog(LOG_WARNING, "Anisotropic filtering not supported");
+#endif
+        } break;
+        default: break;
     }
-#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((texIsPOT) || (texNPOTSupported))
-    {
-        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorythm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
-        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
-        TraceLog(LOG_INFO, "[TEX ID %i] Mipmaps generated automatically", texture->id);
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+    SetStateTexture(0, 0);
+}
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
-        #define MAX(a,b) (((a)>(b))?(a):(b))
+// Enable rendering to texture (fbo)
+void rlEnableRenderTexture(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Textures are kept bound after drawing (GL state cache), they are unbound on render target change
+    // to avoid a feedback loop if render texture is bound to any texture unit (error on WebGL)
+    for (int i = 0; i < MAX_STATE_TEXTURE_UNITS; i++) if (glState.textures[i] != 0) SetStateTexture(i, 0);
 
-        texture->mipmaps =  1 + (int)floor(log(MAX(texture->width, texture->height))/log(2));
-    }
-#endif
-    else TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps can not be generated", texture->id);
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    //glDisable(GL_CULL_FACE);    // Allow double side drawing for texture flipping
+    //glCullFace(GL_FRONT);
+#endif
 }
 
-// Upload vertex data into a VAO (if supported) and VBO
-void rlLoadMesh(Mesh *mesh, bool dynamic)
+// Disable rendering to texture
+void rlDisableRenderTexture(void)
 {
-    if (mesh->vaoId > 0)
-    {
-        // Check if mesh has already been loaded in GPU
-        TraceLog(LOG_WARNING, "Trying to re-load an already loaded mesh");
-        return;
-    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    for (int i = 0; i < MAX_STATE_TEXTURE_UNITS; i++) if (glState.textures[i] != 0) SetStateTexture(i, 0);
 
-    mesh->vaoId = 0;        // Vertex Array Object
-    mesh->vboId[0] = 0;     // Vertex positions VBO
-    mesh->vboId[1] = 0;     // Vertex texcoords VBO
-    mesh->vboId[2] = 0;     // Vertex normals VBO
-    mesh->vboId[3] = 0;     // Vertex colors VBO
-    mesh->vboId[4] = 0;     // Vertex tangents VBO
-    mesh->vboId[5] = 0;     // Vertex texcoords2 VBO
-    mesh->vboId[6] = 0;     // Vertex indices VBO
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    int drawHint = GL_STATIC_DRAW;
-    if (dynamic) drawHint = GL_DYNAMIC_DRAW;
+    //glEnable(GL_CULL_FACE);
+    //glCullFace(GL_BACK);
+#endif
+}
 
-    if (vaoSupported)
-    {
-        // Initialize Quads VAO (Buffer A)
-        glGenVertexArrays(1, &mesh->vaoId);
-        glBindVertexArray(mesh->vaoId);
-    }
+// Enable depth test
+void rlEnableDepthTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    depthTestEnabled = true;
+#endif
+    glEnable(GL_DEPTH_TEST);
+}
 
-    // NOTE: Attributes must be uploaded considering default locations points
+// Disable depth test
+void rlDisableDepthTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    depthTestEnabled = false;
+#endif
+    glDisable(GL_DEPTH_TEST);
+}
 
-    // Enable vertex attributes: position (shader-location = 0)
-    glGenBuffers(1, &mesh->vboId[0]);
-    glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[0]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*mesh->vertexCount, mesh->vertices, drawHint);
-    glVertexAttribPointer(0, 3, GL_FLOAT, 0, 0, 0);
-    glEnableVertexAttribArray(0);
+// Enable backface culling
+void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
 
-    // Enable vertex attributes: texcoords (shader-location = 1)
-    glGenBuffers(1, &mesh->vboId[1]);
-    glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[1]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*mesh->vertexCount, mesh->texcoords, drawHint);
-    glVertexAttribPointer(1, 2, GL_FLOAT, 0, 0, 0);
-    glEnableVertexAttribArray(1);
+// Disable backface culling
+void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
 
-    // Enable vertex attributes: normals (shader-location = 2)
-    if (mesh->normals != NULL)
-    {
-        glGenBuffers(1, &mesh->vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*mesh->vertexCount, mesh->normals, drawHint);
-        glVertexAttribPointer(2, 3, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(2);
-    }
-    else
+// Enable scissor test
+// NOTE: On batched backends scissor state is registered per draw call, no need to flush the batch
+void rlEnableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!scissorEnabled)
     {
-        // Default color vertex attribute set to WHITE
-        glVertexAttrib3f(2, 1.0f, 1.0f, 1.0f);
-        glDisableVertexAttribArray(2);
+        scissorEnabled = true;
+        NewDrawCall();
     }
+#endif
+    glEnable(GL_SCISSOR_TEST);
+}
 
-    // Default color vertex attribute (shader-location = 3)
-    if (mesh->colors != NULL)
-    {
-        glGenBuffers(1, &mesh->vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*mesh->vertexCount, mesh->colors, drawHint);
-        glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-        glEnableVertexAttribArray(3);
-    }
-    else
+// Disable scissor test
+void rlDisableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (scissorEnabled)
     {
-        // Default color vertex attribute set to WHITE
-        glVertexAttrib4f(3, 1.0f, 1.0f, 1.0f, 1.0f);
-        glDisableVertexAttribArray(3);
+        scissorEnabled = false;
+        NewDrawCall();
     }
+#endif
+    glDisable(GL_SCISSOR_TEST);
+}
 
-    // Default tangent vertex attribute (shader-location = 4)
-    if (mesh->tangents != NULL)
-    {
-        glGenBuffers(1, &mesh->vboId[4]);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[4]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*mesh->vertexCount, mesh->tangents, drawHint);
-        glVertexAttribPointer(4, 4, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(4);
-    }
-    else
+// Scissor test
+void rlScissor(int x, int y, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((scissorRec[0] != x) || (scissorRec[1] != y) || (scissorRec[2] != width) || (scissorRec[3] != height))
     {
-        // Default tangents vertex attribute
-        glVertexAttrib4f(4, 0.0f, 0.0f, 0.0f, 0.0f);
-        glDisableVertexAttribArray(4);
+        scissorRec[0] = x;
+        scissorRec[1] = y;
+        scissorRec[2] = width;
+        scissorRec[3] = height;
+        if (scissorEnabled) NewDrawCall();
     }
+#endif
+    glScissor(x, y, width, height);
+}
 
-    // Default texcoord2 vertex attribute (shader-location = 5)
-    if (mesh->texcoords2 != NULL)
-    {
-        glGenBuffers(1, &mesh->vboId[5]);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[5]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*mesh->vertexCount, mesh->texcoords2, drawHint);
-        glVertexAttribPointer(5, 2, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(5);
-    }
-    else
+// Push scissor rectangle (bottom-left origin) and enable scissor test,
+// rectangle is intersected with current one (nested scissor areas)
+// NOTE: On batched backends effective rectangle is registered per draw call, no need to flush the batch
+void rlPushScissor(int x, int y, int width, int height)
+{
+    if (scissorStackCounter >= MAX_SCISSOR_STACK_SIZE)
     {
-        // Default texcoord2 vertex attribute
-        glVertexAttrib2f(5, 0.0f, 0.0f);
-        glDisableVertexAttribArray(5);
+        TraceLog(LOG_ERROR, "Scissor stack overflow");
+        return;
     }
 
-    if (mesh->indices != NULL)
+    if (scissorStackCounter > 0)
     {
-        glGenBuffers(1, &mesh->vboId[6]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboId[6]);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned short)*mesh->triangleCount*3, mesh->indices, drawHint);
+        int *top = scissorStack[scissorStackCounter - 1];
+        int left = (x > top[0])? x : top[0];
+        int bottom = (y > top[1])? y : top[1];
+        int right = ((x + width) < (top[0] + top[2]))? (x + width) : (top[0] + top[2]);
+        int upper = ((y + height) < (top[1] + top[3]))? (y + height) : (top[1] + top[3]);
+
+        // NOTE: Disjoint rectangles result in an empty rectangle, nothing is drawn
+        x = left;
+        y = bottom;
+        width = (right > left)? (right - left) : 0;
+        height = (upper > bottom)? (upper - bottom) : 0;
     }
 
-    if (vaoSupported)
-    {
-        if (mesh->vaoId > 0) TraceLog(LOG_INFO, "[VAO ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
-        else TraceLog(LOG_WARNING, "Mesh could not be uploaded to VRAM (GPU)");
-    }
-    else
-    {
-        TraceLog(LOG_INFO, "[VBOs] Mesh uploaded successfully to VRAM (GPU)");
-    }
-#endif
+    scissorStack[scissorStackCounter][0] = x;
+    scissorStack[scissorStackCounter][1] = y;
+    scissorStack[scissorStackCounter][2] = width;
+    scissorStack[scissorStackCounter][3] = height;
+    scissorStackCounter++;
+
+    rlScissor(x, y, width, height);
+    rlEnableScissorTest();
 }
 
-// Load a new attributes buffer
-unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer, int size, bool dynamic)
+// Pop scissor rectangle, previous one is restored (scissor test is disabled if stack gets empty)
+void rlPopScissor(void)
 {
-    unsigned int id = 0;
+    if (scissorStackCounter > 0) scissorStackCounter--;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    int drawHint = GL_STATIC_DRAW;
-    if (dynamic) drawHint = GL_DYNAMIC_DRAW;
+    if (scissorStackCounter > 0)
+    {
+        int *top = scissorStack[scissorStackCounter - 1];
+        rlScissor(top[0], top[1], top[2], top[3]);
+    }
+    else rlDisableScissorTest();
+}
 
-    if (vaoSupported) glBindVertexArray(vaoId);
+// Enable wire mode
+void rlEnableWireMode(void)
+{
+#if defined (GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: glPolygonMode() not available on OpenGL ES
+    glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+#endif
+}
 
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferData(GL_ARRAY_BUFFER, size, buffer, drawHint);
-    glVertexAttribPointer(shaderLoc, 2, GL_FLOAT, 0, 0, 0);
-    glEnableVertexAttribArray(shaderLoc);
+// Disable wire mode
+void rlDisableWireMode(void)
+{
+#if defined (GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: glPolygonMode() not available on OpenGL ES
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+#endif
+}
+
+// Unload texture from GPU memory
+void rlDeleteTextures(unsigned int id)
+{
+    if (id > 0) glDeleteTextures(1, &id);
 
-    if (vaoSupported) glBindVertexArray(0);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id > 0) ResetStateObject(id, 0, 0);
 #endif
+}
 
-    return id;
+// Unload render texture from GPU memory
+void rlDeleteRenderTextures(RenderTexture2D target)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (target.texture.id > 0) glDeleteTextures(1, &target.texture.id);
+    if (target.depth.id > 0)
+    {
+        if (target.depthTexture) glDeleteTextures(1, &target.depth.id);
+        else glDeleteRenderbuffers(1, &target.depth.id);
+    }
+
+    ResetStateObject(target.texture.id, 0, 0);
+    if (target.depthTexture) ResetStateObject(target.depth.id, 0, 0);
+
+    if (target.id > 0) glDeleteFramebuffers(1, &target.id);
+
+    TraceLog(LOG_INFO, "[FBO ID %i] Unloaded render texture data from VRAM (GPU)", target.id);
+#endif
 }
 
-// Update vertex or index data on GPU (upload new data to one buffer)
-void rlUpdateMesh(Mesh mesh, int buffer, int num)
+// Unload shader from GPU memory
+void rlDeleteShader(unsigned int id)
 {
-    rlUpdateMeshAt(mesh, buffer, num, 0);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id != 0)
+    {
+        glDeleteProgram(id);
+        ResetStateObject(0, id, 0);
+    }
+#endif
 }
 
-// Update vertex or index data on GPU, at index
-// WARNING: error checking is in place that will cause the data to not be
-//          updated if offset + size exceeds what the buffer can hold
-void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index)
+// Unload vertex data (VAO) from GPU memory
+void rlDeleteVertexArrays(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Activate mesh VAO
-    if (vaoSupported) glBindVertexArray(mesh.vaoId);
+    if (vaoSupported)
+    {
+        if (id != 0)
+        {
+            glDeleteVertexArrays(1, &id);
+            ResetStateObject(0, 0, id);
+        }
+        TraceLog(LOG_INFO, "[VAO ID %i] Unloaded model data from VRAM (GPU)", id);
+    }
+#endif
+}
 
-    switch (buffer)
+// Unload vertex data (VBO) from GPU memory
+void rlDeleteBuffers(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id != 0)
     {
-        case 0:     // Update vertices (vertex position)
+        glDeleteBuffers(1, &id);
+        if (!vaoSupported) TraceLog(LOG_INFO, "[VBO ID %i] Unloaded model vertex data from VRAM (GPU)", id);
+    }
+#endif
+}
+
+// Clear color buffer with color
+void rlClearColor(byte r, byte g, byte b, byte a)
+{
+    // Color values clamp to 0.0f(0) and 1.0f(255)
+    float cr = (float)r/255;
+    float cg = (float)g/255;
+    float cb = (float)b/255;
+    float ca = (float)a/255;
+
+    glClearColor(cr, cg, cb, ca);
+}
+
+// Clear used screen buffers (color and depth)
+void rlClearScreenBuffers(void)
+{
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
+    //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Depth sort mode: layers depth steps restart with depth buffer cleared
+    // NOTE: Steps are not reset on batch draws, primitives drawn after a mid-frame flush must stay on top
+    memset(layerDepthSteps, 0, sizeof(layerDepthSteps));
+    currentDepth = GetBaseDepth();
+#endif
+}
+
+// Update GPU buffer with new data
+void rlUpdateBuffer(int bufferId, void *data, int dataSize)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, bufferId);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - rlgl Functions
+//----------------------------------------------------------------------------------
+
+// Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
+void rlglInit(int width, int height)
+{
+    // Check OpenGL information and capabilities
+    //------------------------------------------------------------------------------
+
+    // Print current OpenGL and GLSL version
+    TraceLog(LOG_INFO, "GPU: Vendor:   %s", glGetString(GL_VENDOR));
+    TraceLog(LOG_INFO, "GPU: Renderer: %s", glGetString(GL_RENDERER));
+    TraceLog(LOG_INFO, "GPU: Version:  %s", glGetString(GL_VERSION));
+    TraceLog(LOG_INFO, "GPU: GLSL:     %s", glGetString(GL_SHADING_LANGUAGE_VERSION));
+
+    // NOTE: We can get a bunch of extra information about GPU capabilities (glGet*)
+    //int maxTexSize;
+    //glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTexSize);
+    //TraceLog(LOG_INFO, "GL_MAX_TEXTURE_SIZE: %i", maxTexSize);
+
+    //GL_MAX_TEXTURE_IMAGE_UNITS
+    //GL_MAX_VIEWPORT_DIMS
+
+    //int numAuxBuffers;
+    //glGetIntegerv(GL_AUX_BUFFERS, &numAuxBuffers);
+    //TraceLog(LOG_INFO, "GL_AUX_BUFFERS: %i", numAuxBuffers);
+
+    //GLint numComp = 0;
+    //GLint format[32] = { 0 };
+    //glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &numComp);
+    //glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, format);
+    //for (int i = 0; i < numComp; i++) TraceLog(LOG_INFO, "Supported compressed format: 0x%x", format[i]);
+
+    // NOTE: We don't need that much data on screen... right now...
+
+    // TODO: Automatize extensions loading using rlLoadExtensions() and GLAD
+    // Actually, when rlglInit() is called in InitWindow() in core.c,
+    // OpenGL required extensions have already been loaded (PLATFORM_DESKTOP)
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Get supported extensions list
+    GLint numExt = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: On OpenGL 3.3 VAO and NPOT are supported by default
+    vaoSupported = true;
+
+    // Multiple texture extensions supported by default
+    texNPOTSupported = true;
+    texFloatSupported = true;
+    texDepthSupported = true;
+
+    // We get a list of available extensions and we check for some of them (compressed textures)
+    // NOTE: We don't need to check again supported extensions but we do (GLAD already dealt with that)
+    glGetIntegerv(GL_NUM_EXTENSIONS, &numExt);
+
+    // Allocate numExt strings pointers
+    const char **extList = RL_MALLOC(sizeof(const char *)*numExt);
+
+    // Get extensions strings
+    for (int i = 0; i < numExt; i++) extList[i] = (const char *)glGetStringi(GL_EXTENSIONS, i);
+
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    // Allocate 512 strings pointers (2 KB)
+    const char **extList = RL_MALLOC(sizeof(const char *)*512);
+
+    const char *extensions = (const char *)glGetString(GL_EXTENSIONS);  // One big const string
+
+    // NOTE: We have to duplicate string because glGetString() returns a const string
+    int len = strlen(extensions) + 1;
+    char *extensionsDup = (char *)RL_CALLOC(len, sizeof(char));
+    strcpy(extensionsDup, extensions);
+
+    extList[numExt] = extensionsDup;
+
+    for (int i = 0; i < len; i++)
+    {
+        if (extensionsDup[i] == ' ')
         {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.vertices, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.vertices);
+            extensionsDup[i] = '\0';
 
-        } break;
-        case 1:     // Update texcoords (vertex texture coordinates)
+            numExt++;
+            extList[numExt] = &extensionsDup[i + 1];
+        }
+    }
+
+    // NOTE: Duplicated string (extensionsDup) must be deallocated
+#endif
+
+    TraceLog(LOG_INFO, "Number of supported extensions: %i", numExt);
+
+    // Show supported extensions
+    //for (int i = 0; i < numExt; i++)  TraceLog(LOG_INFO, "Supported extension: %s", extList[i]);
+
+    // Check required extensions
+    for (int i = 0; i < numExt; i++)
+    {
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        // Check VAO support
+        // NOTE: Only check on OpenGL ES, OpenGL 3.3 has VAO support as core feature
+        if (strcmp(extList[i], (const char *)"GL_OES_vertex_array_object") == 0)
         {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords);
+            // The extension is supported by our hardware and driver, try to get related functions pointers
+            // NOTE: emscripten does not support VAOs natively, it uses emulation and it reduces overall performance...
+            glGenVertexArrays = (PFNGLGENVERTEXARRAYSOESPROC)eglGetProcAddress("glGenVertexArraysOES");
+            glBindVertexArray = (PFNGLBINDVERTEXARRAYOESPROC)eglGetProcAddress("glBindVertexArrayOES");
+            glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSOESPROC)eglGetProcAddress("glDeleteVertexArraysOES");
+            //glIsVertexArray = (PFNGLISVERTEXARRAYOESPROC)eglGetProcAddress("glIsVertexArrayOES");     // NOTE: Fails in WebGL, omitted
+
+            if ((glGenVertexArrays != NULL) && (glBindVertexArray != NULL) && (glDeleteVertexArrays != NULL)) vaoSupported = true;
+        }
+
+        // Check NPOT textures support
+        // NOTE: Only check on OpenGL ES, OpenGL 3.3 has NPOT textures full support as core feature
+        if (strcmp(extList[i], (const char *)"GL_OES_texture_npot") == 0) texNPOTSupported = true;
+
+        // Check texture float support
+        if (strcmp(extList[i], (const char *)"GL_OES_texture_float") == 0) texFloatSupported = true;
+
+        // Check depth texture support
+        if ((strcmp(extList[i], (const char *)"GL_OES_depth_texture") == 0) ||
+            (strcmp(extList[i], (const char *)"GL_WEBGL_depth_texture") == 0)) texDepthSupported = true;
+
+        // Check instanced arrays support
+        // NOTE: Only check on OpenGL ES, OpenGL 3.3 has instancing support as core feature
+        if ((strcmp(extList[i], (const char *)"GL_ANGLE_instanced_arrays") == 0) && (glDrawArraysInstanced == NULL))
+        {
+            glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)eglGetProcAddress("glDrawArraysInstancedANGLE");
+            glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)eglGetProcAddress("glVertexAttribDivisorANGLE");
+        }
+        else if ((strcmp(extList[i], (const char *)"GL_EXT_instanced_arrays") == 0) && (glDrawArraysInstanced == NULL))
+        {
+            glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)eglGetProcAddress("glDrawArraysInstancedEXT");
+            glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)eglGetProcAddress("glVertexAttribDivisorEXT");
+        }
+        else if ((strcmp(extList[i], (const char *)"GL_NV_instanced_arrays") == 0) && (glDrawArraysInstanced == NULL))
+        {
+            glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)eglGetProcAddress("glDrawArraysInstancedNV");
+            glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)eglGetProcAddress("glVertexAttribDivisorNV");
+        }
+
+        // Check timer queries support
+        // NOTE: Only check on OpenGL ES, OpenGL 3.3 has timestamp queries as core feature
+        if (strcmp(extList[i], (const char *)"GL_EXT_disjoint_timer_query") == 0)
+        {
+            glGenQueries = (PFNGLGENQUERIESEXTPROC)eglGetProcAddress("glGenQueriesEXT");
+            glDeleteQueries = (PFNGLDELETEQUERIESEXTPROC)eglGetProcAddress("glDeleteQueriesEXT");
+            glQueryCounter = (PFNGLQUERYCOUNTEREXTPROC)eglGetProcAddress("glQueryCounterEXT");
+            glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVEXTPROC)eglGetProcAddress("glGetQueryObjectivEXT");
+            glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VEXTPROC)eglGetProcAddress("glGetQueryObjectui64vEXT");
+        }
+
+        // Check program binaries support
+        if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+        {
+            glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)eglGetProcAddress("glGetProgramBinaryOES");
+            glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)eglGetProcAddress("glProgramBinaryOES");
+        }
+
+        if (strcmp(extList[i], (const char *)"GL_OES_depth24") == 0) maxDepthBits = 24;
+        if (strcmp(extList[i], (const char *)"GL_OES_depth32") == 0) maxDepthBits = 32;
+#endif
+        // DDS texture compression support
+        if ((strcmp(extList[i], (const char *)"GL_EXT_texture_compression_s3tc") == 0) ||
+            (strcmp(extList[i], (const char *)"GL_WEBGL_compressed_texture_s3tc") == 0) ||
+            (strcmp(extList[i], (const char *)"GL_WEBKIT_WEBGL_compressed_texture_s3tc") == 0)) texCompDXTSupported = true;
+
+        // ETC1 texture compression support
+        if ((strcmp(extList[i], (const char *)"GL_OES_compressed_ETC1_RGB8_texture") == 0) ||
+            (strcmp(extList[i], (const char *)"GL_WEBGL_compressed_texture_etc1") == 0)) texCompETC1Supported = true;
+
+        // ETC2/EAC texture compression support
+        if (strcmp(extList[i], (const char *)"GL_ARB_ES3_compatibility") == 0) texCompETC2Supported = true;
+
+        // PVR texture compression support
+        if (strcmp(extList[i], (const char *)"GL_IMG_texture_compression_pvrtc") == 0) texCompPVRTSupported = true;
+
+        // ASTC texture compression support
+        if (strcmp(extList[i], (const char *)"GL_KHR_texture_compression_astc_hdr") == 0) texCompASTCSupported = true;
+
+        // Anisotropic texture filter support
+        if (strcmp(extList[i], (const char *)"GL_EXT_texture_filter_anisotropic") == 0)
+        {
+            texAnisotropicFilterSupported = true;
+            glGetFloatv(0x84FF, &maxAnisotropicLevel);   // GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
+        }
+
+        // Clamp mirror wrap mode supported
+        if (strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) texMirrorClampSupported = true;
+
+        // Debug marker support
+        if (strcmp(extList[i], (const char *)"GL_EXT_debug_marker") == 0) debugMarkerSupported = true;
+    }
+
+    // Free extensions pointers
+    RL_FREE(extList);
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    // Check persistent mapped buffers support (OpenGL 4.4 core or GL_ARB_buffer_storage)
+    // NOTE: GLAD loads glBufferStorage() only if the extension is exposed (always the case on 4.4+ drivers),
+    // fence sync objects are also required (OpenGL 3.2 core or GL_ARB_sync, could be missing on OpenGL 2.1)
+    if ((glBufferStorage != NULL) && (glFenceSync != NULL) && (glClientWaitSync != NULL)) bufferStorageSupported = true;
+#endif
+
+    // Check instancing support
+    // NOTE: On OpenGL 2.1 context, GLAD does not load instancing functions (OpenGL 3.3 core),
+    // on OpenGL ES2 they are loaded from extensions (if available)
+    if ((glDrawArraysInstanced != NULL) && (glVertexAttribDivisor != NULL)) instancingSupported = true;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Check asynchronous texture updates support (pixel buffer objects mapping and fence sync)
+    // NOTE: On OpenGL 2.1 context, GLAD loads these functions only if GL_ARB_map_buffer_range and GL_ARB_sync are exposed
+    if ((glMapBufferRange != NULL) && (glUnmapBuffer != NULL) && (glFenceSync != NULL) &&
+        (glClientWaitSync != NULL) && (glDeleteSync != NULL)) pixelBufferSupported = true;
+#endif
+
+    // Check timer queries support
+    // NOTE: On OpenGL 2.1 context, GLAD loads glQueryCounter() only if GL_ARB_timer_query is exposed
+    if ((glGenQueries != NULL) && (glDeleteQueries != NULL) && (glQueryCounter != NULL) &&
+        (glGetQueryObjectiv != NULL) && (glGetQueryObjectui64v != NULL)) gpuTimersSupported = true;
+
+    // Check program binaries support
+    // NOTE: On OpenGL 3.3 context, GLAD loads these functions only if GL_ARB_get_program_binary is exposed (OpenGL 4.1 core),
+    // some drivers expose the extension but no binary format (binaries can not be retrieved)
+    if ((glGetProgramBinary != NULL) && (glProgramBinary != NULL))
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        if (binaryFormats > 0) programBinarySupported = true;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    RL_FREE(extensionsDup);    // Duplicated string must be deallocated
+
+    if (vaoSupported) TraceLog(LOG_INFO, "[EXTENSION] VAO extension detected, VAO functions initialized successfully");
+    else TraceLog(LOG_WARNING, "[EXTENSION] VAO extension not found, VAO usage not supported");
+
+    if (texNPOTSupported) TraceLog(LOG_INFO, "[EXTENSION] NPOT textures extension detected, full NPOT textures supported");
+    else TraceLog(LOG_WARNING, "[EXTENSION] NPOT textures extension not found, limited NPOT support (no-mipmaps, no-repeat)");
+#endif
+
+    if (texCompDXTSupported) TraceLog(LOG_INFO, "[EXTENSION] DXT compressed textures supported");
+    if (texCompETC1Supported) TraceLog(LOG_INFO, "[EXTENSION] ETC1 compressed textures supported");
+    if (texCompETC2Supported) TraceLog(LOG_INFO, "[EXTENSION] ETC2/EAC compressed textures supported");
+    if (texCompPVRTSupported) TraceLog(LOG_INFO, "[EXTENSION] PVRT compressed textures supported");
+    if (texCompASTCSupported) TraceLog(LOG_INFO, "[EXTENSION] ASTC compressed textures supported");
+
+    if (texAnisotropicFilterSupported) TraceLog(LOG_INFO, "[EXTENSION] Anisotropic textures filtering supported (max: %.0fX)", maxAnisotropicLevel);
+    if (texMirrorClampSupported) TraceLog(LOG_INFO, "[EXTENSION] Mirror clamp wrap texture mode supported");
+
+    if (debugMarkerSupported) TraceLog(LOG_INFO, "[EXTENSION] Debug Marker supported");
+
+    if (bufferStorageSupported) TraceLog(LOG_INFO, "[EXTENSION] Buffer storage supported, using persistent mapped batch buffers");
+    if (instancingSupported) TraceLog(LOG_INFO, "[EXTENSION] Instanced arrays supported, using sprites instancing");
+    if (pixelBufferSupported) TraceLog(LOG_INFO, "[EXTENSION] Pixel buffer objects mapping supported, asynchronous texture updates and screen readbacks available");
+    if (gpuTimersSupported) TraceLog(LOG_INFO, "[EXTENSION] Timer queries supported, GPU timers available");
+    if (programBinarySupported) TraceLog(LOG_INFO, "[EXTENSION] Program binaries supported, shader cache available");
+
+    // Initialize buffers, default shaders and default textures
+    //----------------------------------------------------------
+    // Init GL state cache, current state is unknown
+    rlResetStateCache();
+
+    // Init default white texture
+    unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
+    defaultTextureId = rlLoadTexture(pixels, 1, 1, UNCOMPRESSED_R8G8B8A8, 1);
+
+    if (defaultTextureId != 0) TraceLog(LOG_INFO, "[TEX ID %i] Base white texture loaded successfully", defaultTextureId);
+    else TraceLog(LOG_WARNING, "Base white texture could not be loaded");
+
+    // Init default Shader (customized for GL 3.3 and ES2)
+    defaultShader = LoadShaderDefault();
+    currentShader = defaultShader;
+
+    // Init default vertex arrays buffers
+    LoadBuffersDefault();
+
+    // Init sprite instancing shader and buffers (if supported)
+    if (instancingSupported) LoadInstancing();
+
+    // Init transformations matrix accumulator
+    transformMatrix = MatrixIdentity();
+
+    // Check SIMD vertex transform kernel, scalar fallback is used if results are not bit-exact
+    simdTransformVerified = CheckTransformKernel();
+
+    // Init draw calls tracking system
+    draws = (DrawCall *)RL_MALLOC(sizeof(DrawCall)*batchDrawCalls);
+    ResetDrawCalls(0);
+
+    drawsCounter = 1;
+
+    // Init internal matrix stack (emulating OpenGL 1.1)
+    for (int i = 0; i < MAX_MATRIX_STACK_SIZE; i++) stack[i] = MatrixIdentity();
+
+    // Init internal projection and modelview matrices
+    projection = MatrixIdentity();
+    modelview = MatrixIdentity();
+    currentMatrix = &modelview;
+#endif      // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
+    // Initialize OpenGL default states
+    //----------------------------------------------------------
+    // Init state: Depth test
+    glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
+    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+
+    // Init state: Blending mode
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
+    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+
+    // Init state: Culling
+    // NOTE: All shapes/models triangles are drawn CCW
+    glCullFace(GL_BACK);                                    // Cull the back face (default)
+    glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
+    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    // Init state: Color hints (deprecated in OpenGL 3.0+)
+    glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_NICEST);      // Improve quality of color and texture coordinate interpolation
+    glShadeModel(GL_SMOOTH);                                // Smooth shading between vertex (vertex colors interpolation)
+#endif
+
+#if defined(GRAPHICS_API_SOFTWARE)
+    // Init software backend default framebuffer color buffer
+    SwResizeScreen(width, height);
+    glViewport(0, 0, width, height);
+#endif
+
+    // Init state: Color/Depth buffers clear
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);                   // Set clear color (black)
+    glClearDepth(1.0f);                                     // Set clear depth value (default)
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear color and depth buffers (depth buffer required for 3D)
+
+    // Store screen size into global variables
+    framebufferWidth = width;
+    framebufferHeight = height;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    currentViewport[2] = width;
+    currentViewport[3] = height;
+#endif
+
+    TraceLog(LOG_INFO, "OpenGL default states initialized successfully");
+}
+
+// Vertex Buffer Object deinitialization (memory free)
+void rlglClose(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (instancingSupported) UnloadInstancing();    // Unload sprite instancing (uses default fragment shader)
+    UnloadShaderDefault();              // Unload default shader
+    UnloadBuffersDefault();             // Unload default buffers
+    glDeleteTextures(1, &defaultTextureId); // Unload default texture
+
+    TraceLog(LOG_INFO, "[TEX ID %i] Unloaded texture data (base white texture) from VRAM", defaultTextureId);
+
+    for (int i = 0; i < staticBatchesCounter; i++) rlUnloadStaticBatch(i + 1);
+    RL_FREE(staticBatches);
+    staticBatches = NULL;
+    staticBatchesCounter = 0;
+
+    RL_FREE(textureOpaque);
+    textureOpaque = NULL;
+    textureOpaqueCapacity = 0;
+
+    // NOTE: Shaders not unloaded by user also have their uniforms cache freed
+    for (int i = 0; i < shaderUniformsCounter; i++) UnloadShaderUniforms(shaderUniforms[i].program);
+    RL_FREE(shaderUniforms);
+    shaderUniforms = NULL;
+    shaderUniformsCounter = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    for (int i = 0; i < MAX_TEXTURE_UPLOAD_BUFFERS; i++)
+    {
+        if (uploadBuffers[i].fence != NULL) glDeleteSync((GLsync)uploadBuffers[i].fence);
+        if (uploadBuffers[i].pboId != 0) glDeleteBuffers(1, &uploadBuffers[i].pboId);
+    }
+    memset(uploadBuffers, 0, sizeof(uploadBuffers));
+
+    for (int i = 0; i < MAX_SCREEN_READBACKS; i++)
+    {
+        if (screenReadbacks[i].fence != NULL) glDeleteSync((GLsync)screenReadbacks[i].fence);
+        if (screenReadbacks[i].pboId != 0) glDeleteBuffers(1, &screenReadbacks[i].pboId);
+    }
+#endif
+
+    if (gpuTimersLoaded)
+    {
+        for (int i = 0; i < MAX_GPU_TIMER_FRAMES; i++) glDeleteQueries(MAX_GPU_TIMER_QUERIES, gpuTimerFrames[i].queries);
+        gpuTimersLoaded = false;
+        gpuTimersEnabled = false;
+    }
+
+    RL_FREE(draws);
+    RL_FREE(drawsWork);
+    RL_FREE(drawsBounds);
+    RL_FREE(drawsSorted);
+    drawsWork = NULL;
+    drawsBounds = NULL;
+    drawsSorted = NULL;
+    drawsScratchCapacity = 0;
+    RL_FREE(transformRuns);
+    transformRuns = NULL;
+    transformRunsCounter = 0;
+    transformRunsCapacity = 0;
+#endif
+
+    for (int i = 0; i < MAX_SCREEN_READBACKS; i++) RL_FREE(screenReadbacks[i].pixels);
+    memset(screenReadbacks, 0, sizeof(screenReadbacks));
+    screenReadbackFirst = 0;
+    screenReadbacksCounter = 0;
+
+#if defined(GRAPHICS_API_SOFTWARE)
+    SwClose();
+#endif
+
+#if defined(GRAPHICS_API_NONE)
+    rlResetRecordCommands();
+    RL_FREE(recordCommands);
+    RL_FREE(recordTextures);
+    recordCommands = NULL;
+    recordCommandsCapacity = 0;
+    recordTextures = NULL;
+    recordTexturesCounter = 0;
+    recordTexturesCapacity = 0;
+#endif
+}
+
+// Update and draw internal buffers
+void rlglDraw(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Only process data if we have data to process
+    if (vertexData[currentBuffer].vCounter > 0)
+    {
+        // Apply pending vertex transforms (required before merging, it uses vertex positions)
+        ApplyTransformRuns();
+
+        int registered = 0;
+        for (int i = 0; i < drawsCounter; i++) if (draws[i].vertexCount > 0) registered++;
+
+        if (deferredMode && (drawsCounter > 1)) MergeDrawCalls();
+
+        // NOTE: Static batches are drawn without depth sorting, captured draws are only ordered by layer
+        if (depthSortMode || (drawsCounter > 1)) SortDrawCalls(depthSortMode && (staticBatchCapture == 0));
+
+        // Static batch capture: vertex data is kept for static batch instead of drawn
+        if (staticBatchCapture != 0)
+        {
+            CaptureStaticBatch();
+            flushReason = FLUSH_REASON_STATE_CHANGE;
+            return;
+        }
+
+        frameStats.flushes++;
+        if (flushReason == FLUSH_REASON_BUFFER_LIMIT) frameStats.flushesBufferLimit++;
+        else if (flushReason == FLUSH_REASON_DRAWCALL_LIMIT) frameStats.flushesDrawCallLimit++;
+        else frameStats.flushesStateChange++;
+
+        for (int i = 0; i < drawsCounter; i++) frameStats.vertexCount += draws[i].vertexCount;
+
+        drawsRegisteredCounter += registered;
+        for (int i = 0; i < drawsCounter; i++) if (draws[i].vertexCount > 0) drawsSubmittedCounter++;
+
+        UpdateBuffersDefault();
+        DrawBuffersDefault();       // NOTE: Stereo rendering is checked inside
+    }
+
+    flushReason = FLUSH_REASON_STATE_CHANGE;
+#endif
+}
+
+// Returns current OpenGL version
+int rlGetVersion(void)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    return OPENGL_11;
+#elif defined(GRAPHICS_API_OPENGL_21)
+    #if defined(__APPLE__)
+        return OPENGL_33;       // NOTE: Force OpenGL 3.3 on OSX
+    #else
+        return OPENGL_21;
+    #endif
+#elif defined(GRAPHICS_API_OPENGL_33)
+    return OPENGL_33;
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    return OPENGL_ES_20;
+#endif
+}
+
+// Check internal buffer overflow for a given number of vertex
+bool rlCheckBufferLimit(int vCount)
+{
+    bool overflow = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((vertexData[currentBuffer].vCounter + vCount) >= (batchElements*4))
+    {
+        // Grow buffers if enabled, overflow is only reported if they could not grow
+        if (!batchGrowth || !GrowBuffersDefault(vCount)) overflow = true;
+    }
+
+    // NOTE: Overflow is always followed by a forced rlglDraw()
+    if (overflow) flushReason = FLUSH_REASON_BUFFER_LIMIT;
+#endif
+    return overflow;
+}
+
+// Get number of times CPU had to wait for GPU to release a batch buffer
+// NOTE: Only persistent mapped buffers are fence-synced, orphaned buffers never wait on CPU side
+int rlGetFenceWaitCount(void)
+{
+    int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    count = fenceWaitCounter;
+#endif
+    return count;
+}
+
+// Set batch limits: elements (quads) and draw calls per batch
+// NOTE: Current batch is drawn and internal buffers are reloaded with the new sizes
+void rlSetBatchLimits(int elements, int drawCalls)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlglDraw();
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Indices are 16bit on OpenGL ES 2.0, it limits vertex count to 65536
+    if (elements > 16384) elements = 16384;
+#endif
+
+    if ((elements > 0) && (elements != batchElements))
+    {
+        UnloadBuffersDefault();
+        batchElements = elements;
+        LoadBuffersDefault();
+
+        TraceLog(LOG_INFO, "Batch elements limit set to %i", batchElements);
+    }
+
+    if ((drawCalls > 0) && (drawCalls != batchDrawCalls))
+    {
+        RL_FREE(draws);
+        batchDrawCalls = drawCalls;
+        draws = (DrawCall *)RL_MALLOC(sizeof(DrawCall)*batchDrawCalls);
+        ResetDrawCalls(0);
+        drawsCounter = 1;
+
+        TraceLog(LOG_INFO, "Batch draw calls limit set to %i", batchDrawCalls);
+    }
+#endif
+}
+
+// Set batch automatic growth: when limits are reached, CPU arrays and GPU buffers are
+// doubled in size instead of forcing a draw of the current batch
+void rlSetBatchGrowth(bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    batchGrowth = enabled;
+#endif
+}
+
+// Set deferred mode: draw calls sharing mode, texture, shader, blending and scissor state
+// are merged on rlglDraw() when the draws in between do not overlap them on screen
+void rlSetDeferredMode(bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (enabled && (mergeVertices == NULL)) mergeVertices = (BatchVertex *)RL_CALLOC(4*batchElements, sizeof(BatchVertex));
+
+    deferredMode = enabled;
+#endif
+}
+
+// Set draw layer for following primitives, draw calls are ordered by layer on rlglDraw()
+// NOTE: Painter's order is kept inside a layer, layers are drawn from lowest to highest
+void rlSetLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (layer < 0) layer = 0;
+    else if (layer > (MAX_BATCH_LAYERS - 1)) layer = MAX_BATCH_LAYERS - 1;
+
+    if (currentLayer != layer)
+    {
+        currentLayer = layer;
+        NewDrawCall();
+
+        if (depthSortMode) currentDepth = GetBaseDepth();
+    }
+#endif
+}
+
+// Set depth sort mode: primitives depth is given by its layer and its order inside the layer, opaque draws
+// are drawn first from the nearest layer with depth writes (hidden fragments are rejected by depth test),
+// translucent draws are drawn after them from the farthest layer, depth tested but without depth writes
+// NOTE: Only alpha blended draws with default shader, opaque vertex colors and opaque textures are considered opaque,
+// depth buffer is required and it must be cleared every frame (ClearBackground()), layers depth steps
+// (MAX_BATCH_LAYERS*MAX_LAYER_DEPTH_STEPS, 2^20) require a 24bit depth buffer
+void rlSetDepthSortMode(bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: Software rasterizer has no depth buffer, draws are only ordered by layer
+    if (enabled) TraceLog(LOG_WARNING, "Depth sort mode not supported by software rasterizer");
+    enabled = false;
+#endif
+    if (depthSortMode != enabled)
+    {
+        rlglDraw();
+
+        depthSortMode = enabled;
+        memset(layerDepthSteps, 0, sizeof(layerDepthSteps));
+        currentDepth = GetBaseDepth();
+    }
+#endif
+}
+
+// Set view culling: 2D draws (textures, rectangles, circles, rings, text) check their bounds
+// against visible area and are rejected before any vertex work if they are fully outside
+// NOTE: Visible area is computed from current matrices (Camera2D, BeginMode2D()) and recomputed only when they change
+void rlSetViewCulling(bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    viewCulling = enabled;
+#endif
+}
+
+// Check 2D bounds (current transform space) are fully outside visible area, always false if view culling is disabled
+// NOTE: Never culled with perspective or 3D transforms, on stereo rendering or while capturing a static batch
+bool rlCheckViewCulled(float xmin, float ymin, float xmax, float ymax)
+{
+    bool culled = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (viewCulling && !stereoRender && (staticBatchCapture == 0))
+    {
+        UpdateCullMatrix();
+
+        if (viewBoundsValid) culled = ((xmax < viewBounds[0]) || (xmin > viewBounds[2]) || (ymax < viewBounds[1]) || (ymin > viewBounds[3]));
+        if (culled) frameStats.primitivesCulled++;
+    }
+#endif
+    return culled;
+}
+
+// Get draw calls registered and submitted to GPU (after merging), accumulated along current frame
+void rlGetDrawCallCounts(int *registered, int *submitted)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (registered != NULL) *registered = drawsRegisteredCounter;
+    if (submitted != NULL) *submitted = drawsSubmittedCounter;
+#else
+    if (registered != NULL) *registered = 0;
+    if (submitted != NULL) *submitted = 0;
+#endif
+}
+
+// Get renderer statistics for current frame
+rlFrameStats rlGetFrameStats(void)
+{
+    rlFrameStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = frameStats;
+#endif
+    return stats;
+}
+
+// Reset renderer statistics (new frame)
+void rlResetFrameStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    memset(&frameStats, 0, sizeof(rlFrameStats));
+    drawsRegisteredCounter = 0;
+    drawsSubmittedCounter = 0;
+#endif
+}
+
+// Reset GL state cache, all state is considered unknown and next state changes are always issued
+// NOTE: Required if OpenGL state is changed outside rlgl (custom OpenGL code or external libraries)
+void rlResetStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glState.program = (unsigned int)-1;
+    glState.vaoId = (unsigned int)-1;
+    glState.activeTexture = -1;
+    for (int i = 0; i < MAX_STATE_TEXTURE_UNITS; i++) glState.textures[i] = (unsigned int)-1;
+    glState.blendMode = -1;
+
+    // NOTE: Uniforms could also have been uploaded outside rlgl
+    for (int i = 0; i < MAX_STATE_PROGRAMS; i++) programStates[i].valid = 0;
+#endif
+}
+
+// Enable GPU timer queries
+// NOTE: Query objects for all frames in flight are generated on first enable
+void rlEnableGpuTimers(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!gpuTimersSupported)
+    {
+        TraceLog(LOG_WARNING, "GPU timer queries not supported, GPU timers can not be enabled");
+        return;
+    }
+
+    if (!gpuTimersLoaded)
+    {
+        for (int i = 0; i < MAX_GPU_TIMER_FRAMES; i++) glGenQueries(MAX_GPU_TIMER_QUERIES, gpuTimerFrames[i].queries);
+        gpuTimersLoaded = true;
+    }
+
+    gpuTimersEnabled = true;
+#endif
+}
+
+// Disable GPU timer queries
+// NOTE: Frame being timed is discarded, last resolved timings are kept
+void rlDisableGpuTimers(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    gpuTimersEnabled = false;
+    gpuTimerFrame = -1;
+    for (int i = 0; i < MAX_GPU_TIMER_FRAMES; i++) gpuTimerFrames[i].pending = false;
+#endif
+}
+
+// Check GPU timer queries support
+bool rlGpuTimersSupported(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return gpuTimersSupported;
+#else
+    return false;
+#endif
+}
+
+// Begin GPU timer section
+// NOTE: Timed frame is begun by first section, sections registered before BeginDrawing() (i.e. render texture
+// passes) are timed with that frame, RL_GPU_TIMER_FRAME ends the frame, nested sections of the same type
+// are timed by the outer section
+void rlBeginGpuTimer(int timer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!gpuTimersEnabled || (timer < 0) || (timer >= RL_GPU_TIMER_COUNT)) return;
+
+    if (gpuTimerFrame == -1) BeginGpuTimerFrame();
+
+    gpuTimerDepth[timer]++;
+    if (gpuTimerDepth[timer] > 1) return;
+
+    GpuTimerFrame *frame = &gpuTimerFrames[gpuTimerFrame];
+
+    if (frame->sectionsCount >= MAX_GPU_TIMER_QUERIES/2)
+    {
+        gpuTimerSection[timer] = -1;        // No more queries available for this frame, section not timed
+        return;
+    }
+
+    gpuTimerSection[timer] = frame->sectionsCount;
+    frame->types[frame->sectionsCount] = -1;
+    frame->lastQuery = frame->sectionsCount*2;
+    glQueryCounter(frame->queries[frame->lastQuery], GL_TIMESTAMP);
+    frame->sectionsCount++;
+#endif
+}
+
+// End GPU timer section
+void rlEndGpuTimer(int timer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!gpuTimersEnabled || (timer < 0) || (timer >= RL_GPU_TIMER_COUNT)) return;
+    if ((gpuTimerFrame == -1) || (gpuTimerDepth[timer] == 0)) return;
+
+    gpuTimerDepth[timer]--;
+    if (gpuTimerDepth[timer] > 0) return;
+
+    GpuTimerFrame *frame = &gpuTimerFrames[gpuTimerFrame];
+    int section = gpuTimerSection[timer];
+
+    if (section != -1)
+    {
+        frame->lastQuery = section*2 + 1;
+        glQueryCounter(frame->queries[frame->lastQuery], GL_TIMESTAMP);
+        frame->types[section] = timer;
+    }
+
+    // Frame submitted, results resolved on a later frame
+    if (timer == RL_GPU_TIMER_FRAME)
+    {
+        frame->pending = (frame->sectionsCount > 0);
+        gpuTimerFrame = -1;
+    }
+#endif
+}
+
+// Get GPU timings of last resolved frame
+// NOTE: Results come with a few frames of latency (up to MAX_GPU_TIMER_FRAMES - 1), no GPU wait is ever done
+rlGpuTimings rlGetGpuTimings(void)
+{
+    rlGpuTimings timings = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    timings = gpuTimings;
+#endif
+    return timings;
+}
+
+// Begin static batch capture
+// NOTE: Vertex data is captured before modelview transform, only rlPushMatrix() transforms are applied to
+// captured vertex, modelview current at rlDrawStaticBatch() is applied on drawing (after batch transform)
+void rlBeginStaticBatch(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (staticBatchCapture != 0)
+    {
+        TraceLog(LOG_WARNING, "Static batch capture already started");
+        return;
+    }
+
+    rlglDraw();     // Draw pending vertex data, not part of static batch
+
+    int index = 0;
+    while ((index < staticBatchesCounter) && staticBatches[index].active) index++;
+
+    if (index == staticBatchesCounter)
+    {
+        staticBatches = (StaticBatch *)RL_REALLOC(staticBatches, sizeof(StaticBatch)*(staticBatchesCounter + 1));
+        staticBatchesCounter++;
+    }
+
+    memset(&staticBatches[index], 0, sizeof(StaticBatch));
+    staticBatches[index].active = true;
+
+    staticBatchCapture = index + 1;
+#else
+    TraceLog(LOG_WARNING, "Static batches not supported on OpenGL 1.1");
+#endif
+}
+
+// End static batch capture, upload captured vertex data to GPU
+unsigned int rlEndStaticBatch(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (staticBatchCapture == 0)
+    {
+        TraceLog(LOG_WARNING, "Static batch capture not started");
+        return 0;
+    }
+
+    rlglDraw();     // Capture pending vertex data
+
+    id = staticBatchCapture;
+    staticBatchCapture = 0;
+
+    StaticBatch *batch = &staticBatches[id - 1];
+
+    if (vaoSupported)
+    {
+        glGenVertexArrays(1, &batch->vaoId);
+        SetStateVertexArray(batch->vaoId);
+    }
+
+    glGenBuffers(1, &batch->vboId);
+    glBindBuffer(GL_ARRAY_BUFFER, batch->vboId);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(BatchVertex)*batch->vertexCount, batch->vertices, GL_STATIC_DRAW);
+
+    if (vaoSupported)
+    {
+        SetBufferAttribsDefault();
+        SetStateVertexArray(0);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+#if !defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: Software backend rasterizes vertex data on CPU, it's kept
+    RL_FREE(batch->vertices);
+    batch->vertices = NULL;
+#endif
+
+    TraceLog(LOG_INFO, "[VBO ID %i] Static batch loaded successfully (%i vertex, %i draw calls)", batch->vboId, batch->vertexCount, batch->drawsCount);
+#endif
+    return id;
+}
+
+// Draw static batch with a transform (applied before current modelview)
+// NOTE: Pending vertex data is drawn first to keep drawing order, static batch is drawn with current scissor state,
+// on stereo rendering static batch is drawn once per eye
+void rlDrawStaticBatch(unsigned int id, Matrix transform)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || ((int)id > staticBatchesCounter) || !staticBatches[id - 1].active || ((int)id == staticBatchCapture))
+    {
+        TraceLog(LOG_WARNING, "[SBATCH ID %i] Static batch not valid for drawing", id);
+        return;
+    }
+
+    rlglDraw();
+
+    StaticBatch *batch = &staticBatches[id - 1];
+
+    Matrix matProjection = projection;
+    Matrix matView = modelview;
+    Matrix matModelView = MatrixMultiply(transform, matView);
+
+    int eyesCount = 1;
+    if (stereoRender) eyesCount = 2;
+
+#if defined(GRAPHICS_API_SOFTWARE)
+    rlRecordDraw *recordDraws = (rlRecordDraw *)RL_CALLOC(batch->drawsCount, sizeof(rlRecordDraw));
+
+    for (int i = 0; i < batch->drawsCount; i++)
+    {
+        recordDraws[i].mode = batch->draws[i].mode;
+        recordDraws[i].vertexOffset = batch->draws[i].vertexOffset;
+        recordDraws[i].vertexCount = batch->draws[i].vertexCount;
+        for (int k = 0; k < batch->draws[i].texturesCount; k++) recordDraws[i].textures[k] = batch->draws[i].textures[k];
+        recordDraws[i].texturesCount = batch->draws[i].texturesCount;
+        recordDraws[i].shaderId = batch->draws[i].shader.id;
+        recordDraws[i].blendMode = batch->draws[i].blendMode;
+        recordDraws[i].scissorEnabled = scissorEnabled;
+        for (int k = 0; k < 4; k++) recordDraws[i].scissorRec[k] = scissorRec[k];
+    }
+
+    for (int eye = 0; eye < eyesCount; eye++)
+    {
+        if (eyesCount == 1) modelview = matModelView;
+        else SetStereoEye(eye, matModelView);
+
+        frameStats.vertexCount += batch->vertexCount;
+
+        SwRasterizeBatch(batch->vertices, recordDraws, batch->drawsCount, MatrixMultiply(modelview, projection));
+    }
+
+    RL_FREE(recordDraws);
+#else
+    if (vaoSupported) SetStateVertexArray(batch->vaoId);
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vboId);
+        SetBufferAttribsDefault();
+    }
+
+    int drawBlendMode = -1;
+
+    for (int eye = 0; eye < eyesCount; eye++)
+    {
+        if (eyesCount == 1) modelview = matModelView;
+        else SetStereoEye(eye, matModelView);
+
+        Matrix matMVP = MatrixMultiply(modelview, projection);
+
+        // NOTE: Shader state is set again on every eye, MVP matrix changes per eye
+        unsigned int drawShaderId = 0;
+
+        frameStats.vertexCount += batch->vertexCount;
+
+        for (int i = 0; i < batch->drawsCount; i++)
+        {
+            StaticDraw *draw = &batch->draws[i];
+
+            if (draw->shader.id != drawShaderId)
+            {
+                SetStateProgram(draw->shader.id);
+                FlushShaderUniforms(draw->shader);
+                SetStateUniformMvp(draw->shader, matMVP);
+                SetStateUniformColor(draw->shader, 1.0f, 1.0f, 1.0f, 1.0f);
+                SetStateUniformSampler(draw->shader, 0);
+
+                drawShaderId = draw->shader.id;
+            }
+
+            if (draw->blendMode != drawBlendMode)
+            {
+                SetBlendMode(draw->blendMode);
+                drawBlendMode = draw->blendMode;
+            }
+
+            for (int k = 0; k < draw->texturesCount; k++)
+            {
+                if (SetStateTexture(k, draw->textures[k])) frameStats.textureBinds++;
+            }
+
+            glDrawArrays(draw->mode, draw->vertexOffset, draw->vertexCount);
+
+            frameStats.drawCalls++;
+        }
+    }
+
+    // NOTE: Shader program and textures are kept bound (tracked by GL state cache)
+    if (vaoSupported) SetStateVertexArray(0);
+    else glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    if ((drawBlendMode != -1) && (drawBlendMode != blendMode)) SetBlendMode(blendMode);
+#endif
+
+    // Restore projection/modelview matrices
+    // NOTE: In stereo rendering matrices are being modified to fit every eye
+    projection = matProjection;
+    modelview = matView;
+
+    // Restore viewport covering both eyes
+    if (stereoRender) ResetStereoViewport();
+#endif
+}
+
+// Unload static batch from CPU and GPU memory
+void rlUnloadStaticBatch(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || ((int)id > staticBatchesCounter) || !staticBatches[id - 1].active) return;
+
+    StaticBatch *batch = &staticBatches[id - 1];
+
+    if (batch->vaoId > 0)
+    {
+        glDeleteVertexArrays(1, &batch->vaoId);
+        ResetStateObject(0, 0, batch->vaoId);
+    }
+    if (batch->vboId > 0) glDeleteBuffers(1, &batch->vboId);
+
+    RL_FREE(batch->vertices);
+    RL_FREE(batch->draws);
+
+    TraceLog(LOG_INFO, "[VBO ID %i] Unloaded static batch data from VRAM (GPU)", batch->vboId);
+
+    memset(batch, 0, sizeof(StaticBatch));
+    if ((int)id == staticBatchCapture) staticBatchCapture = 0;
+#endif
+}
+
+// Enable stereo rendering, batch and meshes are drawn for both eyes (eyes must be set with rlSetStereoView())
+// NOTE: If eyes viewports are side by side and every batch draw call uses default shader, both eyes are
+// drawn in a single pass (one instanced draw per draw call), otherwise batch is drawn once per eye
+void rlEnableStereoRender(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!stereoRender)
+    {
+        rlglDraw();
+        stereoRender = true;
+    }
+#endif
+}
+
+// Disable stereo rendering
+void rlDisableStereoRender(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (stereoRender)
+    {
+        rlglDraw();
+        stereoRender = false;
+    }
+#endif
+}
+
+// Check if stereo rendering is enabled
+bool rlIsStereoRenderEnabled(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return stereoRender;
+#else
+    return false;
+#endif
+}
+
+// Set stereo eye (0: left, 1: right) projection, view offset (applied to current modelview) and viewport
+void rlSetStereoView(int eye, Matrix proj, Matrix viewOffset, int x, int y, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((eye < 0) || (eye > 1)) return;
+
+    if (stereoRender) rlglDraw();
+
+    stereoProjection[eye] = proj;
+    stereoViewOffset[eye] = viewOffset;
+    stereoViewport[eye][0] = x;
+    stereoViewport[eye][1] = y;
+    stereoViewport[eye][2] = width;
+    stereoViewport[eye][3] = height;
+#endif
+}
+
+#if defined(GRAPHICS_API_NONE)
+// Get commands recorded by record backend
+// NOTE: Commands are kept until rlResetRecordCommands() is called
+const rlRecordCommand *rlGetRecordCommands(int *count)
+{
+    if (count != NULL) *count = recordCommandsCounter;
+
+    return recordCommands;
+}
+
+// Reset recorded commands, freeing recorded vertex data and draw calls
+void rlResetRecordCommands(void)
+{
+    for (int i = 0; i < recordCommandsCounter; i++)
+    {
+        RL_FREE(recordCommands[i].vertices);
+        RL_FREE(recordCommands[i].draws);
+    }
+
+    recordCommandsCounter = 0;
+}
+#endif
+
+// Set debug marker
+void rlSetDebugMarker(const char *text)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (debugMarkerSupported) glInsertEventMarkerEXT(0, text);
+#endif
+}
+
+// Load OpenGL extensions
+// NOTE: External loader function could be passed as a pointer
+void rlLoadExtensions(void *loader)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_NONE)
+    // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
+    #if !defined(__APPLE__)
+        if (!gladLoadGLLoader((GLADloadproc)loader)) TraceLog(LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
+        else TraceLog(LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
+
+        #if defined(GRAPHICS_API_OPENGL_21)
+        if (GLAD_GL_VERSION_2_1) TraceLog(LOG_INFO, "OpenGL 2.1 profile supported");
+        #elif defined(GRAPHICS_API_OPENGL_33)
+        if (GLAD_GL_VERSION_3_3) TraceLog(LOG_INFO, "OpenGL 3.3 Core profile supported");
+        else TraceLog(LOG_ERROR, "OpenGL 3.3 Core profile not supported");
+        #endif
+    #endif
+
+    // With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
+    //if (GLAD_GL_ARB_vertex_array_object) // Use GL_ARB_vertex_array_object
+#endif
+}
+
+// Get world coordinates from screen coordinates
+Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view)
+{
+    Vector3 result = { 0.0f, 0.0f, 0.0f };
+
+    // Calculate unproject matrix (multiply view patrix by projection matrix) and invert it
+    Matrix matViewProj = MatrixMultiply(view, proj);
+    matViewProj = MatrixInvert(matViewProj);
+
+    // Create quaternion from source point
+    Quaternion quat = { source.x, source.y, source.z, 1.0f };
+
+    // Multiply quat point by unproject matrix
+    quat = QuaternionTransform(quat, matViewProj);
+
+    // Normalized world points in vectors
+    result.x = quat.x/quat.w;
+    result.y = quat.y/quat.w;
+    result.z = quat.z/quat.w;
+
+    return result;
+}
+
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+{
+    SetStateTexture(0, 0);    // Free any old binding
+
+    unsigned int id = 0;
+
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(LOG_WARNING, "OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!texCompDXTSupported) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
+        (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA)))
+    {
+        TraceLog(LOG_WARNING, "DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!texCompETC1Supported) && (format == COMPRESSED_ETC1_RGB))
+    {
+        TraceLog(LOG_WARNING, "ETC1 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!texCompETC2Supported) && ((format == COMPRESSED_ETC2_RGB) || (format == COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        TraceLog(LOG_WARNING, "ETC2 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!texCompPVRTSupported) && ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)))
+    {
+        TraceLog(LOG_WARNING, "PVRT compressed texture format not supported");
+        return id;
+    }
+
+    if ((!texCompASTCSupported) && ((format == COMPRESSED_ASTC_4x4_RGBA) || (format == COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TraceLog(LOG_WARNING, "ASTC compressed texture format not supported");
+        return id;
+    }
+#endif
+#endif      // GRAPHICS_API_OPENGL_11
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);              // Generate texture id
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    //glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
+#endif
+
+    SetStateTexture(0, id);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Register texture opacity (base level), opaque draws write depth on depth sort mode
+    SetTextureOpaque(id, CheckPixelsOpaque(data, width, height, format));
+#endif
+
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
+
+    TraceLog(LOG_DEBUG, "Load texture from data memory address: 0x%x", data);
+
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        TraceLog(LOG_DEBUG, "Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+
+        if (glInternalFormat != -1)
+        {
+            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
+        #if !defined(GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+        #endif
+
+        #if defined(GRAPHICS_API_OPENGL_33)
+            if (format == UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == UNCOMPRESSED_GRAY_ALPHA)
+            {
+            #if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+            #elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+            #endif
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+        #endif
+        }
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    // Texture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
+    if (texNPOTSupported)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    }
+    else
+    {
+        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
+    }
+#else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+#endif
+
+    // Magnification and minification filters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (mipmapCount > 1)
+    {
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+#endif
+
+    // At this point we have the texture loaded in GPU and texture parameters configured
+
+    // NOTE: If mipmaps were not in data, they are not generated automatically
+
+    // Unbind current texture
+    SetStateTexture(0, 0);
+
+    if (id > 0) TraceLog(LOG_INFO, "[TEX ID %i] Texture created successfully (%ix%i - %i mipmaps)", id, width, height, mipmapCount);
+    else TraceLog(LOG_WARNING, "Texture could not be created");
+
+    return id;
+}
+
+// Load depth texture/renderbuffer (to be attached to fbo)
+// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
+unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int glInternalFormat = GL_DEPTH_COMPONENT16;
+
+    if ((bits != 16) && (bits != 24) && (bits != 32)) bits = 16;
+
+    if (bits == 24)
+    {
+#if defined(GRAPHICS_API_OPENGL_33)
+        glInternalFormat = GL_DEPTH_COMPONENT24;
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        if (maxDepthBits >= 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
+#endif
+    }
+
+    if (bits == 32)
+    {
+#if defined(GRAPHICS_API_OPENGL_33)
+        glInternalFormat = GL_DEPTH_COMPONENT32;
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        if (maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
+#endif
+    }
+
+    if (!useRenderBuffer && texDepthSupported)
+    {
+        glGenTextures(1, &id);
+        SetStateTexture(0, id);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        SetStateTexture(0, 0);
+    }
+    else
+    {
+        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
+        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    }
+#endif
+
+    return id;
+}
+
+// Load texture cubemap
+// NOTE: Cubemap data is expected to be 6 images in a single column,
+// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
+unsigned int rlLoadTextureCubemap(void *data, int size, int format)
+{
+    unsigned int cubemapId = 0;
+    unsigned int dataSize = GetPixelDataSize(size, size, format);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGenTextures(1, &cubemapId);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapId);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat != -1)
+    {
+        // Load cubemap faces
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
+#if !defined(GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (format == UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
+        }
+    }
+
+    // Set cubemap texture sampling parameters
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+#endif
+
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+#endif
+
+    return cubemapId;
+}
+
+// Update already loaded texture in GPU with new data
+// NOTE: We don't know safely if internal texture format is the expected one...
+void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data)
+{
+    SetStateTexture(0, id);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Updated data is not scanned (it could be streamed every frame), texture only stays opaque if format has no alpha
+    SetTextureOpaque(id, IsTextureOpaque(id) && CheckPixelsOpaque(NULL, width, height, format));
+#endif
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glFormat, glType, (unsigned char *)data);
+    }
+    else TraceLog(LOG_WARNING, "Texture format updating not supported");
+}
+
+// Update already loaded texture in GPU with new data, asynchronously through pixel buffer objects
+// NOTE: Data is copied to a pixel buffer object (ring of MAX_TEXTURE_UPLOAD_BUFFERS) and the texture update
+// is sourced from it, so the transfer overlaps with rendering; buffers are fenced and only reused once GPU
+// is done reading them. Falls back to rlUpdateTexture() if not supported (OpenGL ES 2.0, old OpenGL 2.1 drivers)
+void rlUpdateTextureAsync(unsigned int id, int width, int height, int format, const void *data)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    SetTextureOpaque(id, IsTextureOpaque(id) && CheckPixelsOpaque(NULL, width, height, format));
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (pixelBufferSupported && (glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
+    {
+        TextureUploadBuffer *buffer = &uploadBuffers[currentUploadBuffer];
+        int dataSize = GetPixelDataSize(width, height, format);
+
+        // Make sure GPU is not reading this buffer anymore (it was used MAX_TEXTURE_UPLOAD_BUFFERS updates ago)
+        if (buffer->fence != NULL)
+        {
+            GLsync fence = (GLsync)buffer->fence;
+
+            if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+            {
+                fenceWaitCounter++;
+                while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) { }
+            }
+
+            glDeleteSync(fence);
+            buffer->fence = NULL;
+        }
+
+        if (buffer->pboId == 0) glGenBuffers(1, &buffer->pboId);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->pboId);
+
+        if (buffer->size < dataSize)
+        {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, dataSize, NULL, GL_STREAM_DRAW);
+            buffer->size = dataSize;
+        }
+
+        // NOTE: Buffer is fenced, no need for driver synchronization on mapping
+        void *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, dataSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+        if (mapped != NULL)
+        {
+            memcpy(mapped, data, dataSize);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+            // NOTE: With a pixel unpack buffer bound, data pointer is an offset into the buffer
+            SetStateTexture(0, id);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glFormat, glType, (void *)0);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+            // Signal when GPU is done with this buffer, checked before next update using it
+            buffer->fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+            currentUploadBuffer++;
+            if (currentUploadBuffer >= MAX_TEXTURE_UPLOAD_BUFFERS) currentUploadBuffer = 0;
+
+            return;
+        }
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        TraceLog(LOG_WARNING, "[PBO ID %i] Pixel buffer could not be mapped, texture updated synchronously", buffer->pboId);
+    }
+#endif
+
+    rlUpdateTexture(id, width, height, format, data);
+}
+
+// Get OpenGL internal formats and data type from raylib PixelFormat
+void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+{
+    *glInternalFormat = -1;
+    *glFormat = -1;
+    *glType = -1;
+
+    switch (format)
+    {
+    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
+        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        #if !defined(GRAPHICS_API_OPENGL_11)
+        case UNCOMPRESSED_R32: if (texFloatSupported) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
+        case UNCOMPRESSED_R32G32B32: if (texFloatSupported) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
+        case UNCOMPRESSED_R32G32B32A32: if (texFloatSupported) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
+        #endif
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R32: if (texFloatSupported) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
+        case UNCOMPRESSED_R32G32B32: if (texFloatSupported) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case UNCOMPRESSED_R32G32B32A32: if (texFloatSupported) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+    #endif
+        #if !defined(GRAPHICS_API_OPENGL_11)
+        case COMPRESSED_DXT1_RGB: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case COMPRESSED_DXT1_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case COMPRESSED_DXT3_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case COMPRESSED_DXT5_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case COMPRESSED_ETC1_RGB: if (texCompETC1Supported) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
+        case COMPRESSED_ETC2_RGB: if (texCompETC2Supported) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case COMPRESSED_ETC2_EAC_RGBA: if (texCompETC2Supported) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case COMPRESSED_PVRT_RGB: if (texCompPVRTSupported) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
+        case COMPRESSED_PVRT_RGBA: if (texCompPVRTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
+        case COMPRESSED_ASTC_4x4_RGBA: if (texCompASTCSupported) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case COMPRESSED_ASTC_8x8_RGBA: if (texCompASTCSupported) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        #endif
+        default: TraceLog(LOG_WARNING, "Texture format not supported"); break;
+    }
+}
+
+// Unload texture from GPU memory
+void rlUnloadTexture(unsigned int id)
+{
+    if (id > 0) glDeleteTextures(1, &id);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id > 0) ResetStateObject(id, 0, 0);
+#endif
+}
+
+// Load a texture to be used for rendering (fbo with default color and depth attachments)
+// NOTE: If colorFormat or depthBits are no supported, no attachment is done
+RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture)
+{
+    RenderTexture2D target = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (useDepthTexture && texDepthSupported) target.depthTexture = true;
+
+    // Create the framebuffer object
+    glGenFramebuffers(1, &target.id);
+    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+
+    // Create fbo color texture attachment
+    //-----------------------------------------------------------------------------------------------------
+    if ((format != -1) && (format < COMPRESSED_DXT1_RGB))
+    {
+        // WARNING: Some texture formats are not supported for fbo color attachment
+        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = format;
+        target.texture.mipmaps = 1;
+    }
+    //-----------------------------------------------------------------------------------------------------
+
+    // Create fbo depth renderbuffer/texture
+    //-----------------------------------------------------------------------------------------------------
+    if (depthBits > 0)
+    {
+        target.depth.id = rlLoadTextureDepth(width, height, depthBits, !useDepthTexture);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+    }
+    //-----------------------------------------------------------------------------------------------------
+
+    // Attach color texture and depth renderbuffer to FBO
+    //-----------------------------------------------------------------------------------------------------
+    rlRenderTextureAttach(target, target.texture.id, 0);    // COLOR attachment
+    rlRenderTextureAttach(target, target.depth.id, 1);      // DEPTH attachment
+    //-----------------------------------------------------------------------------------------------------
+
+    // Check if fbo is complete with attachments (valid)
+    //-----------------------------------------------------------------------------------------------------
+    if (rlRenderTextureComplete(target)) TraceLog(LOG_INFO, "[FBO ID %i] Framebuffer object created successfully", target.id);
+    //-----------------------------------------------------------------------------------------------------
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+
+    return target;
+}
+
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
+void rlRenderTextureAttach(RenderTexture2D target, unsigned int id, int attachType)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+
+    if (attachType == 0) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+    else if (attachType == 1)
+    {
+        if (target.depthTexture) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, id, 0);
+        else glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, id);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+}
+
+// Verify render texture is complete
+bool rlRenderTextureComplete(RenderTexture target)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        switch (status)
+        {
+            case GL_FRAMEBUFFER_UNSUPPORTED: TraceLog(LOG_WARNING, "Framebuffer is unsupported"); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TraceLog(LOG_WARNING, "Framebuffer has incomplete attachment"); break;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TraceLog(LOG_WARNING, "Framebuffer has incomplete dimensions"); break;
+#endif
+            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TraceLog(LOG_WARNING, "Framebuffer has a missing attachment"); break;
+            default: break;
+        }
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    result = (status == GL_FRAMEBUFFER_COMPLETE);
+#endif
+
+    return result;
+}
+
+// Generate mipmap data for selected texture
+void rlGenerateMipmaps(Texture2D *texture)
+{
+    SetStateTexture(0, texture->id);
+
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
+
+    if (((texture->width > 0) && ((texture->width & (texture->width - 1)) == 0)) &&
+        ((texture->height > 0) && ((texture->height & (texture->height - 1)) == 0))) texIsPOT = true;
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (texIsPOT)
+    {
+        // WARNING: Manual mipmap generation only works for RGBA 32bit textures!
+        if (texture->format == UNCOMPRESSED_R8G8B8A8)
+        {
+            // Retrieve texture data from VRAM
+            void *data = rlReadTexturePixels(*texture);
+
+            // NOTE: data size is reallocated to fit mipmaps data
+            // NOTE: CPU mipmap generation only supports RGBA 32bit data
+            int mipmapCount = GenerateMipmaps(data, texture->width, texture->height);
+
+            int size = texture->width*texture->height*4;
+            int offset = size;
+
+            int mipWidth = texture->width/2;
+            int mipHeight = texture->height/2;
+
+            // Load the mipmaps
+            for (int level = 1; level < mipmapCount; level++)
+            {
+                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mipWidth, mipHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char *)data + offset);
+
+                size = mipWidth*mipHeight*4;
+                offset += size;
+
+                mipWidth /= 2;
+                mipHeight /= 2;
+            }
+
+            texture->mipmaps = mipmapCount + 1;
+            RL_FREE(data); // Once mipmaps have been generated and data has been uploaded to GPU VRAM, we can discard RAM data
+
+            TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps [%i] generated manually on CPU side", texture->id, texture->mipmaps);
+        }
+        else TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps could not be generated for texture format", texture->id);
+    }
+#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((texIsPOT) || (texNPOTSupported))
+    {
+        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorythm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
+        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+        TraceLog(LOG_INFO, "[TEX ID %i] Mipmaps generated automatically", texture->id);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+
+        #define MIN(a,b) (((a)<(b))?(a):(b))
+        #define MAX(a,b) (((a)>(b))?(a):(b))
+
+        texture->mipmaps =  1 + (int)floor(log(MAX(texture->width, texture->height))/log(2));
+    }
+#endif
+    else TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps can not be generated", texture->id);
+
+    SetStateTexture(0, 0);
+}
+
+// Upload vertex data into a VAO (if supported) and VBO
+void rlLoadMesh(Mesh *mesh, bool dynamic)
+{
+    if (mesh->vaoId > 0)
+    {
+        // Check if mesh has already been loaded in GPU
+        TraceLog(LOG_WARNING, "Trying to re-load an already loaded mesh");
+        return;
+    }
+
+    mesh->vaoId = 0;        // Vertex Array Object
+    mesh->vboId[0] = 0;     // Vertex positions VBO
+    mesh->vboId[1] = 0;     // Vertex texcoords VBO
+    mesh->vboId[2] = 0;     // Vertex normals VBO
+    mesh->vboId[3] = 0;     // Vertex colors VBO
+    mesh->vboId[4] = 0;     // Vertex tangents VBO
+    mesh->vboId[5] = 0;     // Vertex texcoords2 VBO
+    mesh->vboId[6] = 0;     // Vertex indices VBO
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int drawHint = GL_STATIC_DRAW;
+    if (dynamic) drawHint = GL_DYNAMIC_DRAW;
+
+    if (vaoSupported)
+    {
+        // Initialize Quads VAO (Buffer A)
+        glGenVertexArrays(1, &mesh->vaoId);
+        SetStateVertexArray(mesh->vaoId);
+    }
+
+    // NOTE: Attributes must be uploaded considering default locations points
+
+    // Enable vertex attributes: position (shader-location = 0)
+    glGenBuffers(1, &mesh->vboId[0]);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*mesh->vertexCount, mesh->vertices, drawHint);
+    glVertexAttribPointer(0, 3, GL_FLOAT, 0, 0, 0);
+    glEnableVertexAttribArray(0);
+
+    // Enable vertex attributes: texcoords (shader-location = 1)
+    glGenBuffers(1, &mesh->vboId[1]);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[1]);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*mesh->vertexCount, mesh->texcoords, drawHint);
+    glVertexAttribPointer(1, 2, GL_FLOAT, 0, 0, 0);
+    glEnableVertexAttribArray(1);
+
+    // Enable vertex attributes: normals (shader-location = 2)
+    if (mesh->normals != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[2]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*mesh->vertexCount, mesh->normals, drawHint);
+        glVertexAttribPointer(2, 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(2);
+    }
+    else
+    {
+        // Default color vertex attribute set to WHITE
+        glVertexAttrib3f(2, 1.0f, 1.0f, 1.0f);
+        glDisableVertexAttribArray(2);
+    }
+
+    // Default color vertex attribute (shader-location = 3)
+    if (mesh->colors != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[3]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[3]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*mesh->vertexCount, mesh->colors, drawHint);
+        glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glEnableVertexAttribArray(3);
+    }
+    else
+    {
+        // Default color vertex attribute set to WHITE
+        glVertexAttrib4f(3, 1.0f, 1.0f, 1.0f, 1.0f);
+        glDisableVertexAttribArray(3);
+    }
+
+    // Default tangent vertex attribute (shader-location = 4)
+    if (mesh->tangents != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[4]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[4]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*mesh->vertexCount, mesh->tangents, drawHint);
+        glVertexAttribPointer(4, 4, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(4);
+    }
+    else
+    {
+        // Default tangents vertex attribute
+        glVertexAttrib4f(4, 0.0f, 0.0f, 0.0f, 0.0f);
+        glDisableVertexAttribArray(4);
+    }
+
+    // Default texcoord2 vertex attribute (shader-location = 5)
+    if (mesh->texcoords2 != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[5]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[5]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*mesh->vertexCount, mesh->texcoords2, drawHint);
+        glVertexAttribPointer(5, 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(5);
+    }
+    else
+    {
+        // Default texcoord2 vertex attribute
+        glVertexAttrib2f(5, 0.0f, 0.0f);
+        glDisableVertexAttribArray(5);
+    }
+
+    if (mesh->indices != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[6]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboId[6]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned short)*mesh->triangleCount*3, mesh->indices, drawHint);
+    }
+
+    if (vaoSupported)
+    {
+        if (mesh->vaoId > 0) TraceLog(LOG_INFO, "[VAO ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
+        else TraceLog(LOG_WARNING, "Mesh could not be uploaded to VRAM (GPU)");
+    }
+    else
+    {
+        TraceLog(LOG_INFO, "[VBOs] Mesh uploaded successfully to VRAM (GPU)");
+    }
+#endif
+}
+
+// Load a new attributes buffer
+unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int drawHint = GL_STATIC_DRAW;
+    if (dynamic) drawHint = GL_DYNAMIC_DRAW;
+
+    if (vaoSupported) SetStateVertexArray(vaoId);
+
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, buffer, drawHint);
+    glVertexAttribPointer(shaderLoc, 2, GL_FLOAT, 0, 0, 0);
+    glEnableVertexAttribArray(shaderLoc);
+
+    if (vaoSupported) SetStateVertexArray(0);
+#endif
+
+    return id;
+}
+
+// Update vertex or index data on GPU (upload new data to one buffer)
+void rlUpdateMesh(Mesh mesh, int buffer, int num)
+{
+    rlUpdateMeshAt(mesh, buffer, num, 0);
+}
+
+// Update vertex or index data on GPU, at index
+// WARNING: error checking is in place that will cause the data to not be
+//          updated if offset + size exceeds what the buffer can hold
+void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Activate mesh VAO
+    if (vaoSupported) SetStateVertexArray(mesh.vaoId);
+
+    switch (buffer)
+    {
+        case 0:     // Update vertices (vertex position)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.vertices, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.vertices);
+
+        } break;
+        case 1:     // Update texcoords (vertex texture coordinates)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords);
+
+        } break;
+        case 2:     // Update normals (vertex normals)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.normals, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.normals);
+
+        } break;
+        case 3:     // Update colors (vertex colors)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.colors, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*index, sizeof(unsigned char)*4*num, mesh.colors);
+
+        } break;
+        case 4:     // Update tangents (vertex tangents)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.tangents, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*4*index, sizeof(float)*4*num, mesh.tangents);
+        } break;
+        case 5:     // Update texcoords2 (vertex second texture coordinates)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords2, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords2);
+        } break;
+        case 6:     // Update indices (triangle index buffer)
+        {
+            // the * 3 is because each triangle has 3 indices
+            unsigned short *indices = mesh.indices;
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
+            if (index == 0 && num >= mesh.triangleCount)
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*num*3, indices, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.triangleCount)
+                break;
+            else
+                glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*index*3, sizeof(*indices)*num*3, indices);
+        } break;
+        default: break;
+    }
+
+    // Unbind the current VAO
+    if (vaoSupported) SetStateVertexArray(0);
+
+    // Another option would be using buffer mapping...
+    //mesh.vertices = glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
+    // Now we can modify vertices
+    //glUnmapBuffer(GL_ARRAY_BUFFER);
+#endif
+}
+
+// Draw a 3d mesh with material and transform
+void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    glEnable(GL_TEXTURE_2D);
+    SetStateTexture(0, material.maps[MAP_DIFFUSE].texture.id);
+
+    // NOTE: On OpenGL 1.1 we use Vertex Arrays to draw model
+    glEnableClientState(GL_VERTEX_ARRAY);                   // Enable vertex array
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);            // Enable texture coords array
+    if (mesh.normals != NULL) glEnableClientState(GL_NORMAL_ARRAY);     // Enable normals array
+    if (mesh.colors != NULL) glEnableClientState(GL_COLOR_ARRAY);       // Enable colors array
+
+    glVertexPointer(3, GL_FLOAT, 0, mesh.vertices);         // Pointer to vertex coords array
+    glTexCoordPointer(2, GL_FLOAT, 0, mesh.texcoords);      // Pointer to texture coords array
+    if (mesh.normals != NULL) glNormalPointer(GL_FLOAT, 0, mesh.normals);           // Pointer to normals array
+    if (mesh.colors != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, mesh.colors);   // Pointer to colors array
+
+    rlPushMatrix();
+        rlMultMatrixf(MatrixToFloat(transform));
+        rlColor4ub(material.maps[MAP_DIFFUSE].color.r, material.maps[MAP_DIFFUSE].color.g, material.maps[MAP_DIFFUSE].color.b, material.maps[MAP_DIFFUSE].color.a);
+
+        if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, mesh.indices);
+        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
+    rlPopMatrix();
+
+    glDisableClientState(GL_VERTEX_ARRAY);                  // Disable vertex array
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);           // Disable texture coords array
+    if (mesh.normals != NULL) glDisableClientState(GL_NORMAL_ARRAY);    // Disable normals array
+    if (mesh.colors != NULL) glDisableClientState(GL_NORMAL_ARRAY);     // Disable colors array
+
+    glDisable(GL_TEXTURE_2D);
+    SetStateTexture(0, 0);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlBeginGpuTimer(RL_GPU_TIMER_MESH);
+
+    // Bind shader program
+    SetStateProgram(material.shader.id);
+
+    // Matrices and other values required by shader
+    //-----------------------------------------------------
+    // Calculate and send to shader model matrix (used by PBR shader)
+    if (material.shader.locs[LOC_MATRIX_MODEL] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_MODEL], transform);
+
+    // Upload to shader material.colDiffuse
+    SetStateUniformColor(material.shader, (float)material.maps[MAP_DIFFUSE].color.r/255.0f,
+                                          (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
+                                          (float)material.maps[MAP_DIFFUSE].color.b/255.0f,
+                                          (float)material.maps[MAP_DIFFUSE].color.a/255.0f);
+
+    // Upload to shader material.colSpecular (if available)
+    if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
+    {
+        float colSpecular[4] = { (float)material.maps[MAP_SPECULAR].color.r/255.0f,
+                                 (float)material.maps[MAP_SPECULAR].color.g/255.0f,
+                                 (float)material.maps[MAP_SPECULAR].color.b/255.0f,
+                                 (float)material.maps[MAP_SPECULAR].color.a/255.0f };
+
+        SetShaderValue(material.shader, material.shader.locs[LOC_COLOR_SPECULAR], colSpecular, UNIFORM_VEC4);
+    }
+
+    if (material.shader.locs[LOC_MATRIX_VIEW] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_VIEW], modelview);
+    if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_PROJECTION], projection);
+
+    // At this point the modelview matrix just contains the view matrix (camera)
+    // That's because BeginMode3D() sets it an no model-drawing function modifies it, all use rlPushMatrix() and rlPopMatrix()
+    Matrix matView = modelview;         // View matrix (camera)
+    Matrix matProjection = projection;  // Projection matrix (perspective)
+
+    // TODO: Consider possible transform matrices in the stack
+    // Is this the right order? or should we start with the first stored matrix instead of the last one?
+    //Matrix matStackTransform = MatrixIdentity();
+    //for (int i = stackCounter; i > 0; i--) matStackTransform = MatrixMultiply(stack[i], matStackTransform);
+
+    // Transform to camera-space coordinates
+    Matrix matModelView = MatrixMultiply(transform, MatrixMultiply(transformMatrix, matView));
+    //-----------------------------------------------------
+
+    // Bind active texture maps (if available)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP))
+            {
+                SetStateActiveTexture(i);
+                glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
+                frameStats.textureBinds++;
+            }
+            else if (SetStateTexture(i, material.maps[i].texture.id)) frameStats.textureBinds++;
+
+            if (i == MAP_DIFFUSE) SetStateUniformSampler(material.shader, i);
+            else SetShaderValue(material.shader, material.shader.locs[LOC_MAP_DIFFUSE + i], &i, UNIFORM_INT);
+        }
+    }
+
+    // Upload staged uniforms (material values and values set by user)
+    FlushShaderUniforms(material.shader);
+
+    // Bind vertex array objects (or VBOs)
+    if (vaoSupported) SetStateVertexArray(mesh.vaoId);
+    else
+    {
+        // Bind mesh VBO data: vertex position (shader-location = 0)
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
+        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_POSITION]);
+
+        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
+        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD01]);
+
+        // Bind mesh VBO data: vertex normals (shader-location = 2, if available)
+        if (material.shader.locs[LOC_VERTEX_NORMAL] != -1)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_NORMAL]);
+        }
+
+        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
+        if (material.shader.locs[LOC_VERTEX_COLOR] != -1)
+        {
+            if (mesh.vboId[3] != 0)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
+                glVertexAttribPointer(material.shader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+                glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
+            }
+            else
+            {
+                // Set default value for unused attribute
+                // NOTE: Required when using default shader and no VAO support
+                glVertexAttrib4f(material.shader.locs[LOC_VERTEX_COLOR], 1.0f, 1.0f, 1.0f, 1.0f);
+                glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
+            }
+        }
+
+        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
+        if (material.shader.locs[LOC_VERTEX_TANGENT] != -1)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TANGENT], 4, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TANGENT]);
+        }
+
+        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
+        if (material.shader.locs[LOC_VERTEX_TEXCOORD02] != -1)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
+            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD02], 2, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD02]);
+        }
+
+        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
+    }
+
+    // NOTE: Meshes use custom shaders, on stereo rendering they are drawn once per eye
+    int eyesCount = 1;
+    if (stereoRender) eyesCount = 2;
+
+    for (int eye = 0; eye < eyesCount; eye++)
+    {
+        if (eyesCount == 1) modelview = matModelView;
+        else SetStereoEye(eye, matModelView);
+
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matMVP = MatrixMultiply(modelview, projection);        // Transform to screen-space coordinates
+
+        // Send combined model-view-projection matrix to shader
+        SetStateUniformMvp(material.shader, matMVP);
+
+        // Draw call!
+        if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
+        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
+
+        frameStats.drawCalls++;
+    }
+
+    // Unbind binded cubemap texture maps
+    // NOTE: 2D texture maps are kept bound (tracked by GL state cache)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) && (material.maps[i].texture.id > 0))
+        {
+            SetStateActiveTexture(i);
+            glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+        }
+    }
+
+    // Unind vertex array objects (or VBOs)
+    if (vaoSupported) SetStateVertexArray(0);
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    // Restore projection/modelview matrices
+    // NOTE: In stereo rendering matrices are being modified to fit every eye
+    projection = matProjection;
+    modelview = matView;
+
+    // Restore viewport covering both eyes
+    if (stereoRender) ResetStereoViewport();
+
+    rlEndGpuTimer(RL_GPU_TIMER_MESH);
+#endif
+}
+
+// Unload mesh data from CPU and GPU
+void rlUnloadMesh(Mesh mesh)
+{
+    RL_FREE(mesh.vertices);
+    RL_FREE(mesh.texcoords);
+    RL_FREE(mesh.normals);
+    RL_FREE(mesh.colors);
+    RL_FREE(mesh.tangents);
+    RL_FREE(mesh.texcoords2);
+    RL_FREE(mesh.indices);
+
+    RL_FREE(mesh.animVertices);
+    RL_FREE(mesh.animNormals);
+    RL_FREE(mesh.boneWeights);
+    RL_FREE(mesh.boneIds);
+
+    rlDeleteBuffers(mesh.vboId[0]);   // vertex
+    rlDeleteBuffers(mesh.vboId[1]);   // texcoords
+    rlDeleteBuffers(mesh.vboId[2]);   // normals
+    rlDeleteBuffers(mesh.vboId[3]);   // colors
+    rlDeleteBuffers(mesh.vboId[4]);   // tangents
+    rlDeleteBuffers(mesh.vboId[5]);   // texcoords2
+    rlDeleteBuffers(mesh.vboId[6]);   // indices
+
+    rlDeleteVertexArrays(mesh.vaoId);
+}
+
+// Draw sprite instances using instanced arrays
+// NOTE: Instance data layout (48 bytes): float sourceRec[4], float destRec[4], float origin[2], float rotation, unsigned char tint[4]
+// Same parameters than DrawTexturePro(), returns false if instancing is not supported (instances must be drawn by other means)
+bool rlDrawSpriteInstances(unsigned int textureId, int width, int height, const void *instances, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!instancingSupported || (instanceShader.id == 0)) return false;
+    if (count <= 0) return true;
+
+    // Draw pending batch vertex data, instances must be drawn on top
+    rlglDraw();
+
+    // Upload instances data, growing the buffer if required (orphaning previous storage)
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVboId[1]);
+
+    while (count > instanceBufferCapacity) instanceBufferCapacity *= 2;
+
+    glBufferData(GL_ARRAY_BUFFER, 48*instanceBufferCapacity, NULL, GL_DYNAMIC_DRAW);
+
+    glBufferSubData(GL_ARRAY_BUFFER, 0, 48*count, instances);
+    frameStats.bytesUploaded += 48*count;
+
+    // Transform matrix and current depth are applied as batch vertex would be
+    Matrix matModel = MatrixMultiply(MatrixTranslate(0.0f, 0.0f, currentDepth), useTransformMatrix? transformMatrix : MatrixIdentity());
+    Matrix matMVP = MatrixMultiply(MatrixMultiply(matModel, modelview), projection);
+
+    SetStateProgram(instanceShader.id);
+    SetStateUniformMvp(instanceShader, matMVP);
+    SetStateUniformColor(instanceShader, 1.0f, 1.0f, 1.0f, 1.0f);
+    SetStateUniformSampler(instanceShader, 0);
+    float textureSize[2] = { (float)width, (float)height };
+    SetShaderUniform(instanceShader, instanceTextureSizeLoc, textureSize, UNIFORM_VEC2, 1);
+    FlushShaderUniforms(instanceShader);
+
+    if (vaoSupported) SetStateVertexArray(instanceVaoId);
+    else
+    {
+        // Set instancing attributes (no VAO to keep them)
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVboId[0]);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_POSITION], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(instanceShader.locs[LOC_VERTEX_POSITION]);
+
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVboId[1]);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_TEXCOORD01], 4, GL_FLOAT, 0, 48, (void *)0);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_TEXCOORD02], 4, GL_FLOAT, 0, 48, (void *)16);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 48, (void *)32);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 48, (void *)44);
+
+        for (int i = LOC_VERTEX_TEXCOORD01; i <= LOC_VERTEX_COLOR; i++)
+        {
+            if (instanceShader.locs[i] == -1) continue;     // NOTE: LOC_VERTEX_TANGENT not used
+
+            glEnableVertexAttribArray(instanceShader.locs[i]);
+            glVertexAttribDivisor(instanceShader.locs[i], 1);
+        }
+    }
+
+    if (SetStateTexture(0, textureId)) frameStats.textureBinds++;
+
+    // NOTE: Quad corners are drawn as triangle fan: (0, 0), (0, 1), (1, 1), (1, 0), same order than DrawTexturePro()
+    glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, 4, count);
+    frameStats.drawCalls++;
+
+    if (vaoSupported) SetStateVertexArray(0);
+    else
+    {
+        // Reset attributes divisors, attribute indices are shared with other buffers
+        for (int i = LOC_VERTEX_TEXCOORD01; i <= LOC_VERTEX_COLOR; i++)
+        {
+            if (instanceShader.locs[i] == -1) continue;
+
+            glVertexAttribDivisor(instanceShader.locs[i], 0);
+            glDisableVertexAttribArray(instanceShader.locs[i]);
+        }
+
+        glDisableVertexAttribArray(instanceShader.locs[LOC_VERTEX_POSITION]);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Same depth increment than rlEnd(), following vertex are drawn on top
+    NextPrimitiveDepth();
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Read screen pixel data (color buffer)
+unsigned char *rlReadScreenPixels(int width, int height)
+{
+    unsigned char *imgData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+
+    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
+
+    // Flip image vertically (rows swapped in place) and set alpha component value to 255 (no trasparent image retrieval)
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    FlipPixelsOpaque(imgData, imgData, width, height);
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Request screen pixel data readback, retrieved later with rlGetScreenPixelsAsync()
+// NOTE: Pixels are read into a pixel buffer object, GPU writes it while rendering goes on, up to
+// MAX_SCREEN_READBACKS readbacks can be in flight. Falls back to a synchronous read if not supported
+bool rlReadScreenPixelsAsync(int width, int height)
+{
+    if (screenReadbacksCounter >= MAX_SCREEN_READBACKS)
+    {
+        TraceLog(LOG_WARNING, "Screen readbacks busy, previous readbacks must be retrieved first");
+        return false;
+    }
+
+    ScreenReadback *readback = &screenReadbacks[(screenReadbackFirst + screenReadbacksCounter)%MAX_SCREEN_READBACKS];
+    readback->width = width;
+    readback->height = height;
+    screenReadbacksCounter++;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (pixelBufferSupported)
+    {
+        int dataSize = width*height*4;
+
+        if (readback->pboId == 0) glGenBuffers(1, &readback->pboId);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+
+        if (readback->size < dataSize)
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, dataSize, NULL, GL_STREAM_READ);
+            readback->size = dataSize;
+        }
+
+        // NOTE: With a pixel pack buffer bound, data pointer is an offset into the buffer
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void *)0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        // Signal when GPU has written the buffer, checked before mapping it
+        readback->fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        return true;
+    }
+#endif
+
+    readback->pixels = rlReadScreenPixels(width, height);
+
+    return true;
+}
+
+// Get oldest requested screen pixel data (RGBA, flipped to top-left origin, alpha set to 255)
+// NOTE: Returns NULL only if no readback requested or GPU has not written it yet (never waits), pixels should be freed
+unsigned char *rlGetScreenPixelsAsync(int *width, int *height)
+{
+    if (screenReadbacksCounter == 0) return NULL;
+
+    ScreenReadback *readback = &screenReadbacks[screenReadbackFirst];
+    unsigned char *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (readback->fence != NULL)
+    {
+        // NOTE: Commands are flushed so the fence is eventually signaled, even if nothing else is submitted
+        if (glClientWaitSync((GLsync)readback->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED) return NULL;
+
+        glDeleteSync((GLsync)readback->fence);
+        readback->fence = NULL;
+
+        int dataSize = readback->width*readback->height*4;
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+        unsigned char *mapped = (unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, dataSize, GL_MAP_READ_BIT);
+
+        if (mapped != NULL)
+        {
+            pixels = (unsigned char *)RL_MALLOC(dataSize);
+            FlipPixelsOpaque(pixels, mapped, readback->width, readback->height);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        else
+        {
+            // NOTE: Readback is still delivered (blank) to keep requests order for the caller
+            pixels = (unsigned char *)RL_CALLOC(dataSize, sizeof(unsigned char));
+            TraceLog(LOG_WARNING, "[PBO ID %i] Pixel buffer could not be mapped, screen readback lost", readback->pboId);
+        }
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+    else
+#endif
+    {
+        pixels = readback->pixels;
+        readback->pixels = NULL;
+    }
+
+    if (width != NULL) *width = readback->width;
+    if (height != NULL) *height = readback->height;
+
+    screenReadbackFirst = (screenReadbackFirst + 1)%MAX_SCREEN_READBACKS;
+    screenReadbacksCounter--;
+
+    return pixels;
+}
+
+// Read texture pixel data
+void *rlReadTexturePixels(Texture2D texture)
+{
+    void *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    SetStateTexture(0, texture.id);
+
+    // NOTE: Using texture.id, we can retrieve some texture info (but not on OpenGL ES 2.0)
+    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
+    //int width, height, format;
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+
+    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
+    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
+    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
+    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(texture.format, &glInternalFormat, &glFormat, &glType);
+    unsigned int size = GetPixelDataSize(texture.width, texture.height, texture.format);
+
+    if ((glInternalFormat != -1) && (texture.format < COMPRESSED_DXT1_RGB))
+    {
+        pixels = (unsigned char *)RL_MALLOC(size);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+    }
+    else TraceLog(LOG_WARNING, "Texture data retrieval not suported for pixel format");
+
+    SetStateTexture(0, 0);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // glGetTexImage() is not available on OpenGL ES 2.0
+    // Texture2D width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
+    // Two possible Options:
+    // 1 - Bind texture to color fbo attachment and glReadPixels()
+    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
+    // We are using Option 1, just need to care for texture format on retrieval
+    // NOTE: This behaviour could be conditioned by graphic driver...
+    RenderTexture2D fbo = rlLoadRenderTexture(texture.width, texture.height, UNCOMPRESSED_R8G8B8A8, 16, false);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo.id);
+    SetStateTexture(0, 0);
+
+    // Attach our texture to FBO
+    // NOTE: Previoust attached texture is automatically detached
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.id, 0);
+
+    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
+    pixels = (unsigned char *)RL_MALLOC(GetPixelDataSize(texture.width, texture.height, UNCOMPRESSED_R8G8B8A8));
+    glReadPixels(0, 0, texture.width, texture.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    // Re-attach internal FBO color texture before deleting it
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, fbo.texture.id, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Clean up temporal fbo
+    rlDeleteRenderTextures(fbo);
+#endif
+
+    return pixels;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Shaders Functions
+// NOTE: Those functions are exposed directly to the user in raylib.h
+//----------------------------------------------------------------------------------
+
+// Get default internal texture (white texture)
+Texture2D GetTextureDefault(void)
+{
+    Texture2D texture = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    texture.id = defaultTextureId;
+    texture.width = 1;
+    texture.height = 1;
+    texture.mipmaps = 1;
+    texture.format = UNCOMPRESSED_R8G8B8A8;
+#endif
+    return texture;
+}
+
+// Get default shader
+Shader GetShaderDefault(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return defaultShader;
+#else
+    Shader shader = { 0 };
+    return shader;
+#endif
+}
+
+// Load text data from file
+// NOTE: text chars array should be freed manually
+char *LoadText(const char *fileName)
+{
+    FILE *textFile = NULL;
+    char *text = NULL;
+
+    if (fileName != NULL)
+    {
+        textFile = fopen(fileName,"rt");
+
+        if (textFile != NULL)
+        {
+            fseek(textFile, 0, SEEK_END);
+            int size = ftell(textFile);
+            fseek(textFile, 0, SEEK_SET);
+
+            if (size > 0)
+            {
+                text = (char *)RL_MALLOC(sizeof(char)*(size + 1));
+                int count = fread(text, sizeof(char), size, textFile);
+                text[count] = '\0';
+            }
+
+            fclose(textFile);
+        }
+        else TraceLog(LOG_WARNING, "[%s] Text file could not be opened", fileName);
+    }
+
+    return text;
+}
+
+// Load shader from files and bind default locations
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+Shader LoadShader(const char *vsFileName, const char *fsFileName)
+{
+    Shader shader = { 0 };
+
+    // NOTE: Shader.locs is allocated by LoadShaderCode()
+
+    char *vShaderStr = NULL;
+    char *fShaderStr = NULL;
+
+    if (vsFileName != NULL) vShaderStr = LoadText(vsFileName);
+    if (fsFileName != NULL) fShaderStr = LoadText(fsFileName);
+
+    shader = LoadShaderCode(vShaderStr, fShaderStr);
+
+    if (vShaderStr != NULL) RL_FREE(vShaderStr);
+    if (fShaderStr != NULL) RL_FREE(fShaderStr);
+
+    return shader;
+}
+
+// Load shader from code strings
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+Shader LoadShaderCode(const char *vsCode, const char *fsCode)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    const char *cacheFileName = NULL;
+
+    // Try loading program binary from shader cache (skips shaders compilation and program linkage)
+    // NOTE: Cached binary could be rejected by driver (i.e. driver updated), shaders are compiled in that case
+    if (programBinarySupported && (shaderCachePath[0] != '\0') && ((vsCode != NULL) || (fsCode != NULL)))
+    {
+        cacheFileName = GetShaderCacheFilePath(vsCode, fsCode);
+        shader.id = LoadShaderProgramBinary(cacheFileName);
+    }
+
+    unsigned int vertexShaderId = defaultVShaderId;
+    unsigned int fragmentShaderId = defaultFShaderId;
+
+    if (shader.id == 0)
+    {
+        if (vsCode != NULL) vertexShaderId = CompileShader(vsCode, GL_VERTEX_SHADER);
+        if (fsCode != NULL) fragmentShaderId = CompileShader(fsCode, GL_FRAGMENT_SHADER);
+    }
+
+    if (shader.id > 0) SetShaderDefaultLocations(&shader);
+    else if ((vertexShaderId == defaultVShaderId) && (fragmentShaderId == defaultFShaderId)) shader = defaultShader;
+    else
+    {
+        shader.id = LoadShaderProgram(vertexShaderId, fragmentShaderId);
+
+        if (vertexShaderId != defaultVShaderId) glDeleteShader(vertexShaderId);
+        if (fragmentShaderId != defaultFShaderId) glDeleteShader(fragmentShaderId);
+
+        if ((shader.id > 0) && (cacheFileName != NULL)) SaveShaderProgramBinary(shader.id, cacheFileName);
+
+        if (shader.id == 0)
+        {
+            TraceLog(LOG_WARNING, "Custom shader could not be loaded");
+            shader = defaultShader;
+        }
+
+        // After shader loading, we TRY to set default location names
+        if (shader.id > 0) SetShaderDefaultLocations(&shader);
+    }
+
+    // Get available shader uniforms, registered on shader uniforms cache
+    // NOTE: Default shader (used on failure) already has its own uniforms cache
+    if ((shader.id > 0) && (shader.id != defaultShader.id)) LoadShaderUniforms(shader.id);
+#endif
+
+    return shader;
+}
+
+// Unload shader from GPU memory (VRAM)
+void UnloadShader(Shader shader)
+{
+    if (shader.id > 0)
+    {
+        rlDeleteShader(shader.id);
+        TraceLog(LOG_INFO, "[SHDR ID %i] Unloaded shader program data", shader.id);
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (shader.id != defaultShader.id) UnloadShaderUniforms(shader.id);
+#endif
+    RL_FREE(shader.locs);
+}
+
+// Set shader program binaries cache directory (NULL to disable cache)
+// NOTE: Linked programs are saved to cache and reloaded on next LoadShaderCode() with same code and driver,
+// directory must exist; set it before InitWindow() to also cache shaders loaded on initialization
+void SetShaderCachePath(const char *dirPath)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((dirPath == NULL) || (dirPath[0] == '\0')) shaderCachePath[0] = '\0';
+    else if (strlen(dirPath) < sizeof(shaderCachePath) - 32)
+    {
+        strcpy(shaderCachePath, dirPath);
+        TraceLog(LOG_INFO, "Shader cache directory set to: %s", shaderCachePath);
+    }
+    else TraceLog(LOG_WARNING, "Shader cache directory path too long, cache not enabled");
+#endif
+}
+
+// Begin custom shader mode
+void BeginShaderMode(Shader shader)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Shader is registered per draw call, no need to flush the batch
+    if (currentShader.id != shader.id)
+    {
+        currentShader = shader;
+        NewDrawCall();
+    }
+#endif
+}
+
+// End custom shader mode (returns to default shader)
+void EndShaderMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    BeginShaderMode(defaultShader);
+#endif
+}
+
+// Get shader uniform location
+// NOTE: Active uniforms locations are cached on shader load, OpenGL is only queried for uncached names
+int GetShaderLocation(Shader shader, const char *uniformName)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    ShaderUniform *uniform = GetShaderUniform(GetShaderUniforms(shader.id), uniformName, -1);
+
+    if (uniform != NULL) location = uniform->location;
+    else location = glGetUniformLocation(shader.id, uniformName);
+
+    if (location == -1) TraceLog(LOG_WARNING, "[SHDR ID %i][%s] Shader uniform could not be found", shader.id, uniformName);
+    else TraceLog(LOG_INFO, "[SHDR ID %i][%s] Shader uniform set at location: %i", shader.id, uniformName, location);
+#endif
+    return location;
+}
+
+// Set shader uniform value
+void SetShaderValue(Shader shader, int uniformLoc, const void *value, int uniformType)
+{
+    SetShaderValueV(shader, uniformLoc, value, uniformType, 1);
+}
+
+// Set shader uniform value vector
+// NOTE: Value is staged and uploaded on next draw using the shader, unchanged values are not uploaded again,
+// batch is drawn first if value changes and pending batch draws use the shader
+void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int uniformType, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    SetShaderUniform(shader, uniformLoc, value, uniformType, count);
+#endif
+}
+
+
+// Set shader uniform value (matrix 4x4)
+void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float16 values = MatrixToFloatV(mat);
+
+    SetShaderUniform(shader, uniformLoc, values.v, UNIFORM_MATRIX, 1);
+#endif
+}
+
+// Set shader uniform value for texture
+void SetShaderValueTexture(Shader shader, int uniformLoc, Texture2D texture)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int value = (int)texture.id;
+
+    SetShaderUniform(shader, uniformLoc, &value, UNIFORM_INT, 1);
+#endif
+}
+
+// Set a custom projection matrix (replaces internal projection matrix)
+void SetMatrixProjection(Matrix proj)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    projection = proj;
+    transformVersion++;
+#endif
+}
+
+// Return internal projection matrix
+Matrix GetMatrixProjection(void) {
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_PROJECTION_MATRIX,mat);
+    Matrix m;
+    m.m0  = mat[0];     m.m1  = mat[1];     m.m2  = mat[2];     m.m3  = mat[3];
+    m.m4  = mat[4];     m.m5  = mat[5];     m.m6  = mat[6];     m.m7  = mat[7];
+    m.m8  = mat[8];     m.m9  = mat[9];     m.m10 = mat[10];    m.m11 = mat[11];
+    m.m12 = mat[12];    m.m13 = mat[13];    m.m14 = mat[14];    m.m15 = mat[15];
+    return m;
+#else
+    return projection;
+#endif
+#
+}
+
+// Set a custom modelview matrix (replaces internal modelview matrix)
+void SetMatrixModelview(Matrix view)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    modelview = view;
+    transformVersion++;
+#endif
+}
+
+// Return internal modelview matrix
+Matrix GetMatrixModelview(void)
+{
+    Matrix matrix = MatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
+    matrix.m0  = mat[0];     matrix.m1  = mat[1];     matrix.m2  = mat[2];     matrix.m3  = mat[3];
+    matrix.m4  = mat[4];     matrix.m5  = mat[5];     matrix.m6  = mat[6];     matrix.m7  = mat[7];
+    matrix.m8  = mat[8];     matrix.m9  = mat[9];     matrix.m10 = mat[10];    matrix.m11 = mat[11];
+    matrix.m12 = mat[12];    matrix.m13 = mat[13];    matrix.m14 = mat[14];    matrix.m15 = mat[15];
+#else
+    matrix = modelview;
+#endif
+    return matrix;
+}
+
+// Generate cubemap texture from HDR texture
+// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
+Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size)
+{
+    Texture2D cubemap = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
+    // Other locations should be setup externally in shader before calling the function
+
+    // Set up depth face culling and cubemap seamless
+    glDisable(GL_CULL_FACE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);     // Flag not supported on OpenGL ES 2.0
+#endif
+
+    // Setup framebuffer
+    unsigned int fbo, rbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
+#endif
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+
+    // Set up cubemap to render and attach to framebuffer
+    // NOTE: Faces are stored as 32 bit floating point values
+    glGenTextures(1, &cubemap.id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    for (unsigned int i = 0; i < 6; i++)
+    {
+#if defined(GRAPHICS_API_OPENGL_33)
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB32F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        if (texFloatSupported) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+#endif
+    }
+
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+#endif
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Create projection and different views for each face
+    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, 0.01, 1000.0);
+    Matrix fboViews[6] = {
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
+    };
+
+    // Convert HDR equirectangular environment map to cubemap equivalent
+    SetStateProgram(shader.id);
+    SetStateActiveTexture(0);
+    SetStateTexture(0, map.id);
+    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+
+    // Note: don't forget to configure the viewport to the capture dimensions
+    glViewport(0, 0, size, size);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+    for (int i = 0; i < 6; i++)
+    {
+        SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, cubemap.id, 0);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        FlushShaderUniforms(shader);
+        GenDrawCube();
+    }
+
+    // Unbind framebuffer and textures
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Reset viewport dimensions to default
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+    //glEnable(GL_CULL_FACE);
+
+    // NOTE: Texture2D is a GL_TEXTURE_CUBE_MAP, not a GL_TEXTURE_2D!
+    cubemap.width = size;
+    cubemap.height = size;
+    cubemap.mipmaps = 1;
+    cubemap.format = UNCOMPRESSED_R32G32B32;
+#endif
+    return cubemap;
+}
+
+// Generate irradiance texture using cubemap data
+// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
+Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
+{
+    Texture2D irradiance = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
+    // Other locations should be setup externally in shader before calling the function
+
+    // Setup framebuffer
+    unsigned int fbo, rbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+
+    // Create an irradiance cubemap, and re-scale capture FBO to irradiance scale
+    glGenTextures(1, &irradiance.id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, irradiance.id);
+    for (unsigned int i = 0; i < 6; i++)
+    {
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+    }
+
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Create projection (transposed) and different views for each face
+    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, 0.01, 1000.0);
+    Matrix fboViews[6] = {
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
+    };
+
+    // Solve diffuse integral by convolution to create an irradiance cubemap
+    SetStateProgram(shader.id);
+    SetStateActiveTexture(0);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+
+    // Note: don't forget to configure the viewport to the capture dimensions
+    glViewport(0, 0, size, size);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+    for (int i = 0; i < 6; i++)
+    {
+        SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, irradiance.id, 0);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        FlushShaderUniforms(shader);
+        GenDrawCube();
+    }
+
+    // Unbind framebuffer and textures
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Reset viewport dimensions to default
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+
+    irradiance.width = size;
+    irradiance.height = size;
+    irradiance.mipmaps = 1;
+    //irradiance.format = UNCOMPRESSED_R16G16B16;
+#endif
+    return irradiance;
+}
+
+// Generate prefilter texture using cubemap data
+// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
+Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
+{
+    Texture2D prefilter = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
+    // Other locations should be setup externally in shader before calling the function
+    // TODO: Locations should be taken out of this function... too shader dependant...
+    int roughnessLoc = GetShaderLocation(shader, "roughness");
+
+    // Setup framebuffer
+    unsigned int fbo, rbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+
+    // Create a prefiltered HDR environment map
+    glGenTextures(1, &prefilter.id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, prefilter.id);
+    for (unsigned int i = 0; i < 6; i++)
+    {
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+    }
+
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Generate mipmaps for the prefiltered HDR texture
+    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+
+    // Create projection (transposed) and different views for each face
+    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, 0.01, 1000.0);
+    Matrix fboViews[6] = {
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
+    };
+
+    // Prefilter HDR and store data into mipmap levels
+    SetStateProgram(shader.id);
+    SetStateActiveTexture(0);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+    #define MAX_MIPMAP_LEVELS   5   // Max number of prefilter texture mipmaps
+
+    for (int mip = 0; mip < MAX_MIPMAP_LEVELS; mip++)
+    {
+        // Resize framebuffer according to mip-level size.
+        unsigned int mipWidth  = size*(int)powf(0.5f, (float)mip);
+        unsigned int mipHeight = size*(int)powf(0.5f, (float)mip);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mipWidth, mipHeight);
+        glViewport(0, 0, mipWidth, mipHeight);
+
+        float roughness = (float)mip/(float)(MAX_MIPMAP_LEVELS - 1);
+        SetShaderValue(shader, roughnessLoc, &roughness, UNIFORM_FLOAT);
+
+        for (int i = 0; i < 6; i++)
+        {
+            SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, prefilter.id, mip);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            FlushShaderUniforms(shader);
+            GenDrawCube();
+        }
+    }
+
+    // Unbind framebuffer and textures
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Reset viewport dimensions to default
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+
+    prefilter.width = size;
+    prefilter.height = size;
+    //prefilter.mipmaps = 1 + (int)floor(log(size)/log(2));
+    //prefilter.format = UNCOMPRESSED_R16G16B16;
+#endif
+    return prefilter;
+}
+
+// Generate BRDF texture using cubemap data
+// NOTE: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
+// TODO: Review implementation: https://github.com/HectorMF/BRDFGenerator
+Texture2D GenTextureBRDF(Shader shader, int size)
+{
+    Texture2D brdf = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Generate BRDF convolution texture
+    glGenTextures(1, &brdf.id);
+    SetStateTexture(0, brdf.id);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    if (texFloatSupported) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+#endif
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Render BRDF LUT into a quad using FBO
+    unsigned int fbo, rbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
+#endif
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, brdf.id, 0);
+
+    glViewport(0, 0, size, size);
+    SetStateProgram(shader.id);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    FlushShaderUniforms(shader);
+    GenDrawQuad();
+
+    // Unbind framebuffer and textures
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Unload framebuffer but keep color texture
+    glDeleteRenderbuffers(1, &rbo);
+    glDeleteFramebuffers(1, &fbo);
+
+    // Reset viewport dimensions to default
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+
+    brdf.width = size;
+    brdf.height = size;
+    brdf.mipmaps = 1;
+    brdf.format = UNCOMPRESSED_R32G32B32;
+#endif
+    return brdf;
+}
+
+// Begin blending mode (alpha, additive, multiplied)
+// NOTE: Only 3 blending modes supported, default blend mode is alpha
+void BeginBlendMode(int mode)
+{
+    if ((blendMode != mode) && (mode < 3))
+    {
+        blendMode = mode;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: Blending mode is registered per draw call, no need to flush the batch
+        NewDrawCall();
+#endif
+        SetBlendMode(mode);
+    }
+}
+
+// End blending mode (reset to default: alpha blending)
+void EndBlendMode(void)
+{
+    BeginBlendMode(BLEND_ALPHA);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Set OpenGL blending function for a blending mode
+static void SetBlendMode(int mode)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (glState.blendMode == mode)
+    {
+        frameStats.stateChangesSkipped++;
+        return;
+    }
+
+    glState.blendMode = mode;
+#endif
+    switch (mode)
+    {
+        case BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
+        case BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); break; // Alternative: glBlendFunc(GL_ONE, GL_ONE);
+        case BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
+        default: break;
+    }
+}
+
+// Bind 2D texture to texture unit, skipped if already bound (GL state cache)
+// NOTE: Returns true if texture has been actually bound
+static bool SetStateTexture(int unit, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (unit < MAX_STATE_TEXTURE_UNITS)
+    {
+        if (glState.textures[unit] == id)
+        {
+            frameStats.stateChangesSkipped++;
+            return false;
+        }
+
+        glState.textures[unit] = id;
+    }
+
+    SetStateActiveTexture(unit);
+#endif
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    return true;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Use shader program, skipped if already in use (GL state cache)
+static void SetStateProgram(unsigned int id)
+{
+    if (glState.program == id) frameStats.stateChangesSkipped++;
+    else
+    {
+        glUseProgram(id);
+        glState.program = id;
+    }
+}
+
+// Bind vertex array object, skipped if already bound (GL state cache)
+static void SetStateVertexArray(unsigned int id)
+{
+    if (glState.vaoId == id) frameStats.stateChangesSkipped++;
+    else
+    {
+        glBindVertexArray(id);
+        glState.vaoId = id;
+    }
+}
+
+// Set active texture unit, skipped if already active (GL state cache)
+static void SetStateActiveTexture(int unit)
+{
+    if (glState.activeTexture == unit) frameStats.stateChangesSkipped++;
+    else
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glState.activeTexture = unit;
+    }
+}
+
+// Get shader program built-in uniforms state, program is registered if not tracked yet
+// NOTE: Once all slots are used, oldest registered program state is replaced
+static ProgramState *GetProgramState(unsigned int id)
+{
+    ProgramState *state = NULL;
+
+    for (int i = 0; i < MAX_STATE_PROGRAMS; i++)
+    {
+        if (programStates[i].id == id) return &programStates[i];
+        if ((state == NULL) && (programStates[i].id == 0)) state = &programStates[i];
+    }
+
+    if (state == NULL)
+    {
+        state = &programStates[programStatesNext];
+        programStatesNext = (programStatesNext + 1)%MAX_STATE_PROGRAMS;
+    }
+
+    state->id = id;
+    state->valid = 0;
+
+    return state;
+}
+
+// Upload shader MVP matrix, skipped if already uploaded to shader program (GL state cache)
+// NOTE: Shader program must be in use
+static void SetStateUniformMvp(Shader shader, Matrix mvp)
+{
+    if (shader.locs[LOC_MATRIX_MVP] == -1) return;
+
+    ProgramState *state = GetProgramState(shader.id);
+    float16 values = MatrixToFloatV(mvp);
+
+    if ((state->valid & STATE_UNIFORM_MVP) && (memcmp(state->mvp, values.v, 16*sizeof(float)) == 0)) frameStats.uniformsSkipped++;
+    else
+    {
+        glUniformMatrix4fv(shader.locs[LOC_MATRIX_MVP], 1, false, values.v);
+        memcpy(state->mvp, values.v, 16*sizeof(float));
+        state->valid |= STATE_UNIFORM_MVP;
+    }
+}
+
+// Upload shader diffuse color, skipped if already uploaded to shader program (GL state cache)
+// NOTE: Shader program must be in use
+static void SetStateUniformColor(Shader shader, float r, float g, float b, float a)
+{
+    if (shader.locs[LOC_COLOR_DIFFUSE] == -1) return;
+
+    ProgramState *state = GetProgramState(shader.id);
+
+    if ((state->valid & STATE_UNIFORM_COLOR) && (state->colDiffuse[0] == r) && (state->colDiffuse[1] == g) &&
+        (state->colDiffuse[2] == b) && (state->colDiffuse[3] == a)) frameStats.uniformsSkipped++;
+    else
+    {
+        glUniform4f(shader.locs[LOC_COLOR_DIFFUSE], r, g, b, a);
+        state->colDiffuse[0] = r;
+        state->colDiffuse[1] = g;
+        state->colDiffuse[2] = b;
+        state->colDiffuse[3] = a;
+        state->valid |= STATE_UNIFORM_COLOR;
+    }
+}
+
+// Upload shader diffuse sampler texture unit, skipped if already uploaded to shader program (GL state cache)
+// NOTE: Shader program must be in use
+static void SetStateUniformSampler(Shader shader, int unit)
+{
+    if (shader.locs[LOC_MAP_DIFFUSE] == -1) return;
+
+    ProgramState *state = GetProgramState(shader.id);
+
+    if ((state->valid & STATE_UNIFORM_SAMPLER) && (state->mapDiffuse == unit)) frameStats.uniformsSkipped++;
+    else
+    {
+        glUniform1i(shader.locs[LOC_MAP_DIFFUSE], unit);
+        state->mapDiffuse = unit;
+        state->valid |= STATE_UNIFORM_SAMPLER;
+    }
+}
+
+// Invalidate built-in uniform value uploaded outside state cache (SetShaderValue*())
+static void ResetStateUniform(Shader shader, int uniformLoc)
+{
+    if ((uniformLoc == -1) || (shader.locs == NULL)) return;
+
+    if ((uniformLoc == shader.locs[LOC_MATRIX_MVP]) || (uniformLoc == shader.locs[LOC_COLOR_DIFFUSE]) ||
+        (uniformLoc == shader.locs[LOC_MAP_DIFFUSE]))
+    {
+        for (int i = 0; i < MAX_STATE_PROGRAMS; i++) if (programStates[i].id == shader.id) programStates[i].valid = 0;
+    }
+}
+
+// Forget deleted objects on GL state cache, OpenGL unbinds deleted objects and their ids can be reused
+// NOTE: Use 0 for objects not deleted
+static void ResetStateObject(unsigned int textureId, unsigned int programId, unsigned int vaoId)
+{
+    if (textureId != 0)
+    {
+        for (int i = 0; i < MAX_STATE_TEXTURE_UNITS; i++) if (glState.textures[i] == textureId) glState.textures[i] = 0;
+        SetTextureOpaque(textureId, false);
+    }
+
+    if (programId != 0)
+    {
+        if (glState.program == programId) glState.program = 0;
+        for (int i = 0; i < MAX_STATE_PROGRAMS; i++) if (programStates[i].id == programId) programStates[i].id = 0;
+    }
+
+    if ((vaoId != 0) && (glState.vaoId == vaoId)) glState.vaoId = 0;
+}
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Compile custom shader and return shader id
+static unsigned int CompileShader(const char *shaderStr, int type)
+{
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &shaderStr, NULL);
+
+    GLint success = 0;
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+    if (success != GL_TRUE)
+    {
+        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to compile shader...", shader);
+        int maxLength = 0;
+        int length;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+
+#if defined(_MSC_VER)
+        char *log = RL_MALLOC(maxLength);
+#else
+        char log[maxLength];
+#endif
+        glGetShaderInfoLog(shader, maxLength, &length, log);
+
+        TraceLog(LOG_INFO, "%s", log);
+
+#if defined(_MSC_VER)
+        RL_FREE(log);
+#endif
+    }
+    else TraceLog(LOG_INFO, "[SHDR ID %i] Shader compiled successfully", shader);
+
+    return shader;
+}
+
+// Load custom shader strings and return program id
+static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+
+    GLint success = 0;
+    program = glCreateProgram();
+
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
+
+    // NOTE: Default attribute shader locations must be binded before linking
+    for (int i = 0; i < DEFAULT_ATTRIBS_COUNT; i++) glBindAttribLocation(program, i, defaultAttribNames[i]);
+
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: Program binary must be requested before linking to be retrieved for shader cache
+    if (programBinarySupported && (shaderCachePath[0] != '\0') && (glProgramParameteri != NULL)) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to link shader program...", program);
+
+        int maxLength = 0;
+        int length;
+
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+#if defined(_MSC_VER)
+        char *log = RL_MALLOC(maxLength);
+#else
+        char log[maxLength];
+#endif
+        glGetProgramInfoLog(program, maxLength, &length, log);
+
+        TraceLog(LOG_INFO, "%s", log);
+
+#if defined(_MSC_VER)
+        RL_FREE(log);
+#endif
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else TraceLog(LOG_INFO, "[SHDR ID %i] Shader program loaded successfully", program);
+#endif
+    return program;
+}
+
+// Get shader cache file path from shaders code, attributes binding and driver (vendor, renderer and version)
+// NOTE: Uses FNV-1a 64bit hash, NULL code is hashed as default shader code, attribute names are hashed
+// in location order (array index), so any binding layout change gets a new cache file
+static const char *GetShaderCacheFilePath(const char *vsCode, const char *fsCode)
+{
+    // NOTE: File name buffer fits the largest cache directory plus "/<hash>.shb"
+    static char fileName[sizeof(shaderCachePath) + 32] = { 0 };
+
+    const char *keys[5 + DEFAULT_ATTRIBS_COUNT] = { (vsCode != NULL)? vsCode : defaultVShaderCode, (fsCode != NULL)? fsCode : defaultFShaderCode,
+                             (const char *)glGetString(GL_VENDOR), (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION) };
+
+    for (int i = 0; i < DEFAULT_ATTRIBS_COUNT; i++) keys[5 + i] = defaultAttribNames[i];
+
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (int i = 0; i < (5 + DEFAULT_ATTRIBS_COUNT); i++)
+    {
+        if (keys[i] != NULL)
+        {
+            for (const unsigned char *c = (const unsigned char *)keys[i]; *c != '\0'; c++)
+            {
+                hash ^= *c;
+                hash *= 1099511628211ULL;
+            }
+        }
+
+        // Keys separator, avoids collisions between keys splits
+        hash ^= 0xff;
+        hash *= 1099511628211ULL;
+    }
+
+    sprintf(fileName, "%s/%016llx.shb", shaderCachePath, hash);
+
+    return fileName;
+}
+
+// Load shader program from cached program binary
+// NOTE: Returns 0 if binary is not cached or driver rejects it
+static unsigned int LoadShaderProgramBinary(const char *fileName)
+{
+    unsigned int program = 0;
+
+    FILE *binFile = fopen(fileName, "rb");
+
+    if (binFile != NULL)
+    {
+        // Program binary file: binary format (4 bytes) + binary data
+        fseek(binFile, 0, SEEK_END);
+        int size = (int)ftell(binFile) - (int)sizeof(unsigned int);
+        fseek(binFile, 0, SEEK_SET);
+
+        unsigned int format = 0;
+
+        if ((size > 0) && (fread(&format, sizeof(unsigned int), 1, binFile) == 1))
+        {
+            unsigned char *binary = (unsigned char *)RL_MALLOC(size);
+
+            if (fread(binary, 1, size, binFile) == (size_t)size)
+            {
+                GLint success = 0;
+                program = glCreateProgram();
+
+                glProgramBinary(program, format, binary, size);
+                glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+                if (success == GL_FALSE)
+                {
+                    TraceLog(LOG_INFO, "[SHDR ID %i] Cached program binary rejected by driver, compiling shaders", program);
+                    glDeleteProgram(program);
+                    program = 0;
+                }
+                else TraceLog(LOG_INFO, "[SHDR ID %i] Shader program loaded successfully from cache", program);
+            }
+
+            RL_FREE(binary);
+        }
+
+        fclose(binFile);
+    }
+
+    return program;
+}
+
+// Save shader program binary to cache
+// NOTE: Binary is written to a temporal file and renamed, a partially written file is never loaded
+static void SaveShaderProgramBinary(unsigned int program, const char *fileName)
+{
+    GLint size = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+
+    if (size <= 0)
+    {
+        TraceLog(LOG_WARNING, "[SHDR ID %i] Program binary could not be retrieved for shader cache", program);
+        return;
+    }
+
+    unsigned char *binary = (unsigned char *)RL_MALLOC(size);
+    GLenum format = 0;
+    GLsizei length = 0;
+
+    glGetProgramBinary(program, size, &length, &format, binary);
+
+    char tempFileName[sizeof(shaderCachePath) + 64] = { 0 };
+    FILE *binFile = NULL;
+
+    int tempLength = snprintf(tempFileName, sizeof(tempFileName), "%s.tmp", fileName);
+    if ((tempLength > 0) && (tempLength < (int)sizeof(tempFileName))) binFile = fopen(tempFileName, "wb");
+
+    if (binFile != NULL)
+    {
+        unsigned int binFormat = (unsigned int)format;
+
+        bool result = (length > 0) && (fwrite(&binFormat, sizeof(unsigned int), 1, binFile) == 1) &&
+                      (fwrite(binary, 1, length, binFile) == (size_t)length);
+
+        fclose(binFile);
+
+        remove(fileName);   // NOTE: Required on Windows, rename() fails if file exists
+
+        if (result && (rename(tempFileName, fileName) == 0)) TraceLog(LOG_INFO, "[SHDR ID %i] Program binary saved to shader cache", program);
+        else
+        {
+            remove(tempFileName);
+            TraceLog(LOG_WARNING, "[%s] Program binary could not be saved to shader cache", fileName);
+        }
+    }
+    else TraceLog(LOG_WARNING, "[%s] Shader cache file could not be created", tempFileName);
+
+    RL_FREE(binary);
+}
+
+
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+static Shader LoadShaderDefault(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n" // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+#endif
+    "}                                  \n";
+
+    // Batch vertex shader, same as default vertex shader but providing texture slot
+    const char *batchVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexSlot = vertexTexSlot;   \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Batch fragment shader, texture selected by slot (MAX_BATCH_TEXTURES samplers)
+    // NOTE: Samplers arrays can not be dynamically indexed on OpenGL ES2, slot is constant for all primitive vertex
+    const char *batchFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+    "#define texture texture2D          \n"     // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexSlot;              \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform sampler2D texture3;        \n"
+    "uniform sampler2D texture4;        \n"
+    "uniform sampler2D texture5;        \n"
+    "uniform sampler2D texture6;        \n"
+    "uniform sampler2D texture7;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor;               \n"
+    "    if (fragTexSlot < 0.5) texelColor = texture(texture0, fragTexCoord);      \n"
+    "    else if (fragTexSlot < 1.5) texelColor = texture(texture1, fragTexCoord); \n"
+    "    else if (fragTexSlot < 2.5) texelColor = texture(texture2, fragTexCoord); \n"
+    "    else if (fragTexSlot < 3.5) texelColor = texture(texture3, fragTexCoord); \n"
+    "    else if (fragTexSlot < 4.5) texelColor = texture(texture4, fragTexCoord); \n"
+    "    else if (fragTexSlot < 5.5) texelColor = texture(texture5, fragTexCoord); \n"
+    "    else if (fragTexSlot < 6.5) texelColor = texture(texture6, fragTexCoord); \n"
+    "    else texelColor = texture(texture7, fragTexCoord);                        \n"
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+#endif
+    "}                                  \n";
+
+    // NOTE: Compiled default vertex/fragment shaders are kept for re-use (LoadShader() and sprites instancing),
+    // default shader program uses batch shaders (supporting multiple textures per draw call)
+    defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
+    defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+
+    defaultVShaderCode = defaultVShaderStr;
+    defaultFShaderCode = defaultFShaderStr;
+
+    unsigned int batchVShaderId = CompileShader(batchVShaderStr, GL_VERTEX_SHADER);
+    unsigned int batchFShaderId = CompileShader(batchFShaderStr, GL_FRAGMENT_SHADER);
+
+    shader.id = LoadShaderProgram(batchVShaderId, batchFShaderId);
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Stereo variant of batch shader (shares batch fragment shader), requires instanced drawing
+    if ((shader.id > 0) && (glDrawElementsInstanced != NULL)) stereoShader = LoadShaderStereo(batchFShaderId);
+#endif
+
+    // NOTE: Batch shaders are deleted when program is deleted
+    glDeleteShader(batchVShaderId);
+    glDeleteShader(batchFShaderId);
+
+    if (shader.id > 0)
+    {
+        TraceLog(LOG_INFO, "[SHDR ID %i] Default shader loaded successfully", shader.id);
+
+        // Set default shader locations: attributes locations
+        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
+        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
+        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+
+        // Set default shader locations: uniform locations
+        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
+        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
+        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
 
-        } break;
-        case 2:     // Update normals (vertex normals)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.normals, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.normals);
+        // Set batch textures samplers, one texture unit per texture slot
+        const char *samplerNames[MAX_BATCH_TEXTURES] = { "texture0", "texture1", "texture2", "texture3", "texture4", "texture5", "texture6", "texture7" };
 
-        } break;
-        case 3:     // Update colors (vertex colors)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.colors, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*index, sizeof(unsigned char)*4*num, mesh.colors);
+        SetStateProgram(shader.id);
+        for (int i = 0; i < MAX_BATCH_TEXTURES; i++) glUniform1i(glGetUniformLocation(shader.id, samplerNames[i]), i);
+        SetStateProgram(0);
 
-        } break;
-        case 4:     // Update tangents (vertex tangents)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.tangents, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*4*index, sizeof(float)*4*num, mesh.tangents);
-        } break;
-        case 5:     // Update texcoords2 (vertex second texture coordinates)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords2, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords2);
-        } break;
-        case 6:     // Update indices (triangle index buffer)
-        {
-            // the * 3 is because each triangle has 3 indices
-            unsigned short *indices = mesh.indices;
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
-            if (index == 0 && num >= mesh.triangleCount)
-                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*num*3, indices, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.triangleCount)
-                break;
-            else
-                glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*index*3, sizeof(*indices)*num*3, indices);
-        } break;
-        default: break;
-    }
+        LoadShaderUniforms(shader.id);
 
-    // Unbind the current VAO
-    if (vaoSupported) glBindVertexArray(0);
+        defaultTexSlotLoc = glGetAttribLocation(shader.id, DEFAULT_ATTRIB_TEXSLOT_NAME);
 
-    // Another option would be using buffer mapping...
-    //mesh.vertices = glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-    // Now we can modify vertices
-    //glUnmapBuffer(GL_ARRAY_BUFFER);
-#endif
+        // NOTE: We could also use below function but in case DEFAULT_ATTRIB_* points are
+        // changed for external custom shaders, we just use direct bindings above
+        //SetShaderDefaultLocations(&shader);
+    }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] Default shader could not be loaded", shader.id);
+
+    return shader;
 }
 
-// Draw a 3d mesh with material and transform
-void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+// Load batch shader stereo variant, vertex are drawn twice (two instances) once per eye
+// NOTE: Eye MVP matrix is selected by gl_InstanceID and eye half of the viewport through a clip-space offset,
+// clip distances keep every eye primitives inside its own half, so both eyes are drawn in a single pass
+static Shader LoadShaderStereo(unsigned int fShaderId)
 {
-#if defined(GRAPHICS_API_OPENGL_11)
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, material.maps[MAP_DIFFUSE].texture.id);
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
 
-    // NOTE: On OpenGL 1.1 we use Vertex Arrays to draw model
-    glEnableClientState(GL_VERTEX_ARRAY);                   // Enable vertex array
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);            // Enable texture coords array
-    if (mesh.normals != NULL) glEnableClientState(GL_NORMAL_ARRAY);     // Enable normals array
-    if (mesh.colors != NULL) glEnableClientState(GL_COLOR_ARRAY);       // Enable colors array
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
 
-    glVertexPointer(3, GL_FLOAT, 0, mesh.vertices);         // Pointer to vertex coords array
-    glTexCoordPointer(2, GL_FLOAT, 0, mesh.texcoords);      // Pointer to texture coords array
-    if (mesh.normals != NULL) glNormalPointer(GL_FLOAT, 0, mesh.normals);           // Pointer to normals array
-    if (mesh.colors != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, mesh.colors);   // Pointer to colors array
+    // Stereo vertex shader, same as batch vertex shader but providing one MVP matrix per eye
+    const char *stereoVShaderStr =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
+    "uniform mat4 mvpEyes[2];           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexSlot = vertexTexSlot;   \n"
+    "    vec4 position = mvpEyes[gl_InstanceID]*vec4(vertexPosition, 1.0); \n"
+    "    gl_ClipDistance[0] = position.w - position.x; \n"
+    "    gl_ClipDistance[1] = position.w + position.x; \n"
+    "    position.x = 0.5*position.x + (float(gl_InstanceID) - 0.5)*position.w; \n"
+    "    gl_Position = position;        \n"
+    "}                                  \n";
 
-    rlPushMatrix();
-        rlMultMatrixf(MatrixToFloat(transform));
-        rlColor4ub(material.maps[MAP_DIFFUSE].color.r, material.maps[MAP_DIFFUSE].color.g, material.maps[MAP_DIFFUSE].color.b, material.maps[MAP_DIFFUSE].color.a);
+    unsigned int vertexShaderId = CompileShader(stereoVShaderStr, GL_VERTEX_SHADER);
 
-        if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, mesh.indices);
-        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
-    rlPopMatrix();
+    shader.id = LoadShaderProgram(vertexShaderId, fShaderId);
 
-    glDisableClientState(GL_VERTEX_ARRAY);                  // Disable vertex array
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);           // Disable texture coords array
-    if (mesh.normals != NULL) glDisableClientState(GL_NORMAL_ARRAY);    // Disable normals array
-    if (mesh.colors != NULL) glDisableClientState(GL_NORMAL_ARRAY);     // Disable colors array
+    glDeleteShader(vertexShaderId);     // NOTE: Shader is deleted when program is deleted
 
-    glDisable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (shader.id > 0)
+    {
+        TraceLog(LOG_INFO, "[SHDR ID %i] Stereo shader loaded successfully", shader.id);
+
+        // NOTE: Attributes locations are the same as default shader (binded before linking)
+        shader.locs[LOC_MATRIX_MVP] = glGetUniformLocation(shader.id, "mvpEyes");
+        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
+
+        // Set batch textures samplers, one texture unit per texture slot
+        const char *samplerNames[MAX_BATCH_TEXTURES] = { "texture0", "texture1", "texture2", "texture3", "texture4", "texture5", "texture6", "texture7" };
+
+        SetStateProgram(shader.id);
+        for (int i = 0; i < MAX_BATCH_TEXTURES; i++) glUniform1i(glGetUniformLocation(shader.id, samplerNames[i]), i);
+        SetStateProgram(0);
+    }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] Stereo shader could not be loaded, stereo rendering draws one pass per eye", shader.id);
+
+    return shader;
+}
 #endif
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Bind shader program
-    glUseProgram(material.shader.id);
+// Get location handlers to for shader attributes and uniforms
+// NOTE: If any location is not found, loc point becomes -1
+static void SetShaderDefaultLocations(Shader *shader)
+{
+    // NOTE: Default shader attrib locations have been fixed before linking:
+    //          vertex position location    = 0
+    //          vertex texcoord location    = 1
+    //          vertex normal location      = 2
+    //          vertex color location       = 3
+    //          vertex tangent location     = 4
+    //          vertex texcoord2 location   = 5
 
-    // Matrices and other values required by shader
-    //-----------------------------------------------------
-    // Calculate and send to shader model matrix (used by PBR shader)
-    if (material.shader.locs[LOC_MATRIX_MODEL] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_MODEL], transform);
+    // Get handles to GLSL input attibute locations
+    shader->locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_POSITION_NAME);
+    shader->locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD_NAME);
+    shader->locs[LOC_VERTEX_TEXCOORD02] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD2_NAME);
+    shader->locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_NORMAL_NAME);
+    shader->locs[LOC_VERTEX_TANGENT] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TANGENT_NAME);
+    shader->locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_COLOR_NAME);
 
-    // Upload to shader material.colDiffuse
-    if (material.shader.locs[LOC_COLOR_DIFFUSE] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_DIFFUSE], (float)material.maps[MAP_DIFFUSE].color.r/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.b/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.a/255.0f);
+    // Get handles to GLSL uniform locations (vertex shader)
+    shader->locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader->id, "mvp");
+    shader->locs[LOC_MATRIX_PROJECTION]  = glGetUniformLocation(shader->id, "projection");
+    shader->locs[LOC_MATRIX_VIEW]  = glGetUniformLocation(shader->id, "view");
 
-    // Upload to shader material.colSpecular (if available)
-    if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_SPECULAR], (float)material.maps[MAP_SPECULAR].color.r/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.g/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.b/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.a/255.0f);
+    // Get handles to GLSL uniform locations (fragment shader)
+    shader->locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader->id, "colDiffuse");
+    shader->locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader->id, "texture0");
+    shader->locs[LOC_MAP_SPECULAR] = glGetUniformLocation(shader->id, "texture1");
+    shader->locs[LOC_MAP_NORMAL] = glGetUniformLocation(shader->id, "texture2");
+}
 
-    if (material.shader.locs[LOC_MATRIX_VIEW] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_VIEW], modelview);
-    if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_PROJECTION], projection);
+// Load shader active uniforms cache, uniforms are registered by name and location on hash tables
+// NOTE: Array uniforms are registered without [0] suffix, the way GetShaderLocation() requests them
+static void LoadShaderUniforms(unsigned int program)
+{
+    int uniformCount = 0;
 
-    // At this point the modelview matrix just contains the view matrix (camera)
-    // That's because BeginMode3D() sets it an no model-drawing function modifies it, all use rlPushMatrix() and rlPopMatrix()
-    Matrix matView = modelview;         // View matrix (camera)
-    Matrix matProjection = projection;  // Projection matrix (perspective)
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformCount);
+    if (uniformCount < 0) uniformCount = 0;
 
-    // TODO: Consider possible transform matrices in the stack
-    // Is this the right order? or should we start with the first stored matrix instead of the last one?
-    //Matrix matStackTransform = MatrixIdentity();
-    //for (int i = stackCounter; i > 0; i--) matStackTransform = MatrixMultiply(stack[i], matStackTransform);
+    // Register cache on a free slot, program id could be reused by OpenGL after a program deletion
+    UnloadShaderUniforms(program);
 
-    // Transform to camera-space coordinates
-    Matrix matModelView = MatrixMultiply(transform, MatrixMultiply(transformMatrix, matView));
-    //-----------------------------------------------------
+    int index = 0;
+    while ((index < shaderUniformsCounter) && (shaderUniforms[index].program != 0)) index++;
 
-    // Bind active texture maps (if available)
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    if (index == shaderUniformsCounter)
     {
-        if (material.maps[i].texture.id > 0)
-        {
-            glActiveTexture(GL_TEXTURE0 + i);
-            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
-            else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
-
-            glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
-        }
+        shaderUniforms = (ShaderUniforms *)RL_REALLOC(shaderUniforms, sizeof(ShaderUniforms)*(shaderUniformsCounter + 1));
+        shaderUniformsCounter++;
     }
 
-    // Bind vertex array objects (or VBOs)
-    if (vaoSupported) glBindVertexArray(mesh.vaoId);
-    else
-    {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
-        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_POSITION]);
+    ShaderUniforms *cache = &shaderUniforms[index];
+    memset(cache, 0, sizeof(ShaderUniforms));
+    cache->program = program;
 
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
-        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD01]);
+    // NOTE: Hash tables are kept at least half empty, so probing always ends on an empty entry
+    cache->tableSize = 8;
+    while (cache->tableSize < 2*uniformCount) cache->tableSize *= 2;
 
-        // Bind mesh VBO data: vertex normals (shader-location = 2, if available)
-        if (material.shader.locs[LOC_VERTEX_NORMAL] != -1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_NORMAL]);
-        }
+    cache->uniforms = (ShaderUniform *)RL_CALLOC(uniformCount + 1, sizeof(ShaderUniform));
+    cache->nameTable = (int *)RL_CALLOC(cache->tableSize, sizeof(int));
+    cache->locationTable = (int *)RL_CALLOC(cache->tableSize, sizeof(int));
+    cache->dirty = (int *)RL_CALLOC(uniformCount + 1, sizeof(int));
 
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[LOC_VERTEX_COLOR] != -1)
-        {
-            if (mesh.vboId[3] != 0)
-            {
-                glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
-                glVertexAttribPointer(material.shader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
-            }
-            else
-            {
-                // Set default value for unused attribute
-                // NOTE: Required when using default shader and no VAO support
-                glVertexAttrib4f(material.shader.locs[LOC_VERTEX_COLOR], 1.0f, 1.0f, 1.0f, 1.0f);
-                glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
-            }
-        }
+    unsigned int mask = cache->tableSize - 1;
 
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[LOC_VERTEX_TANGENT] != -1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TANGENT], 4, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TANGENT]);
-        }
+    for (int i = 0; i < uniformCount; i++)
+    {
+        int nameLength = 0;
+        int size = 0;
+        char name[256] = { 0 };     // Assume no variable names longer than 256
+        GLenum type = GL_ZERO;
 
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[LOC_VERTEX_TEXCOORD02] != -1)
+        // Get the name of the uniforms
+        glGetActiveUniform(program, i, sizeof(name) - 1, &nameLength, &size, &type, name);
+        name[nameLength] = '\0';
+
+        if ((nameLength > 3) && (strcmp(name + nameLength - 3, "[0]") == 0))
         {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD02], 2, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD02]);
+            nameLength -= 3;
+            name[nameLength] = '\0';
         }
 
-        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
-    }
+        // Get the location of the named uniform
+        int location = glGetUniformLocation(program, name);
 
-    int eyesCount = 1;
+        TraceLog(LOG_DEBUG, "[SHDR ID %i] Active uniform [%s] set at location: %i", program, name, location);
 
-    for (int eye = 0; eye < eyesCount; eye++)
-    {
-        if (eyesCount == 1) modelview = matModelView;
+        // NOTE: Built-in uniforms (gl_*) have no location, uniforms with too long names are not cached
+        if ((location == -1) || (nameLength >= MAX_UNIFORM_NAME_LENGTH)) continue;
 
-        // Calculate model-view-projection matrix (MVP)
-        Matrix matMVP = MatrixMultiply(modelview, projection);        // Transform to screen-space coordinates
+        ShaderUniform *uniform = &cache->uniforms[cache->uniformsCount];
 
-        // Send combined model-view-projection matrix to shader
-        glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+        strcpy(uniform->name, name);
+        uniform->hash = HashUniformName(name);
+        uniform->location = location;
 
-        // Draw call!
-        if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
-        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
-    }
+        // Register uniform on hash tables (linear probing)
+        unsigned int k = uniform->hash & mask;
+        while (cache->nameTable[k] != 0) k = (k + 1) & mask;
+        cache->nameTable[k] = cache->uniformsCount + 1;
 
-    // Unbind all binded texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        glActiveTexture(GL_TEXTURE0 + i);       // Set shader active texture
-        if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-        else glBindTexture(GL_TEXTURE_2D, 0);   // Unbind current active texture
-    }
+        k = ((unsigned int)location*2654435761u) & mask;
+        while (cache->locationTable[k] != 0) k = (k + 1) & mask;
+        cache->locationTable[k] = cache->uniformsCount + 1;
 
-    // Unind vertex array objects (or VBOs)
-    if (vaoSupported) glBindVertexArray(0);
-    else
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        cache->uniformsCount++;
     }
-
-    // Unbind shader program
-    glUseProgram(0);
-
-    // Restore projection/modelview matrices
-    // NOTE: In stereo rendering matrices are being modified to fit every eye
-    projection = matProjection;
-    modelview = matView;
-#endif
 }
 
-// Unload mesh data from CPU and GPU
-void rlUnloadMesh(Mesh mesh)
+// Unload shader uniforms cache, cache slot is freed for reuse
+static void UnloadShaderUniforms(unsigned int program)
 {
-    RL_FREE(mesh.vertices);
-    RL_FREE(mesh.texcoords);
-    RL_FREE(mesh.normals);
-    RL_FREE(mesh.colors);
-    RL_FREE(mesh.tangents);
-    RL_FREE(mesh.texcoords2);
-    RL_FREE(mesh.indices);
+    ShaderUniforms *uniforms = GetShaderUniforms(program);
+
+    if (uniforms == NULL) return;
 
-    RL_FREE(mesh.animVertices);
-    RL_FREE(mesh.animNormals);
-    RL_FREE(mesh.boneWeights);
-    RL_FREE(mesh.boneIds);
+    RL_FREE(uniforms->uniforms);
+    RL_FREE(uniforms->nameTable);
+    RL_FREE(uniforms->locationTable);
+    RL_FREE(uniforms->dirty);
+    memset(uniforms, 0, sizeof(ShaderUniforms));
+}
 
-    rlDeleteBuffers(mesh.vboId[0]);   // vertex
-    rlDeleteBuffers(mesh.vboId[1]);   // texcoords
-    rlDeleteBuffers(mesh.vboId[2]);   // normals
-    rlDeleteBuffers(mesh.vboId[3]);   // colors
-    rlDeleteBuffers(mesh.vboId[4]);   // tangents
-    rlDeleteBuffers(mesh.vboId[5]);   // texcoords2
-    rlDeleteBuffers(mesh.vboId[6]);   // indices
+// Get shader uniforms cache by program id (NULL if not loaded)
+static ShaderUniforms *GetShaderUniforms(unsigned int program)
+{
+    if (program == 0) return NULL;
 
-    rlDeleteVertexArrays(mesh.vaoId);
+    for (int i = 0; i < shaderUniformsCounter; i++) if (shaderUniforms[i].program == program) return &shaderUniforms[i];
+
+    return NULL;
 }
 
-// Read screen pixel data (color buffer)
-unsigned char *rlReadScreenPixels(int width, int height)
+// Get uniform name hash (FNV-1a, 32 bit)
+static unsigned int HashUniformName(const char *name)
 {
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+    unsigned int hash = 2166136261u;
 
-    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
-    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+    for (const char *c = name; *c != '\0'; c++)
+    {
+        hash ^= (unsigned char)*c;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Get cached uniform by name, or by location if name is NULL (returns NULL if not cached)
+static ShaderUniform *GetShaderUniform(ShaderUniforms *uniforms, const char *name, int location)
+{
+    if (uniforms == NULL) return NULL;
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*sizeof(unsigned char)*4);
+    unsigned int mask = uniforms->tableSize - 1;
 
-    for (int y = height - 1; y >= 0; y--)
+    if (name != NULL)
     {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+        unsigned int hash = HashUniformName(name);
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+        for (unsigned int k = hash & mask; uniforms->nameTable[k] != 0; k = (k + 1) & mask)
+        {
+            ShaderUniform *uniform = &uniforms->uniforms[uniforms->nameTable[k] - 1];
+            if ((uniform->hash == hash) && (strcmp(uniform->name, name) == 0)) return uniform;
+        }
+    }
+    else
+    {
+        for (unsigned int k = ((unsigned int)location*2654435761u) & mask; uniforms->locationTable[k] != 0; k = (k + 1) & mask)
+        {
+            ShaderUniform *uniform = &uniforms->uniforms[uniforms->locationTable[k] - 1];
+            if (uniform->location == location) return uniform;
         }
     }
 
-    RL_FREE(screenData);
-
-    return imgData;     // NOTE: image data should be freed
+    return NULL;
 }
 
-// Read texture pixel data
-void *rlReadTexturePixels(Texture2D texture)
+// Stage shader uniform value, uploaded on next draw using the shader (FlushShaderUniforms())
+// NOTE: Values equal to the staged or uploaded one are skipped. Built-in uniforms (tracked by GL state cache),
+// uncached locations and values bigger than MAX_UNIFORM_VALUE_SIZE are uploaded directly. Only one value
+// is kept per uniform, batch is drawn before any change if pending draw calls use the shader
+static void SetShaderUniform(Shader shader, int location, const void *value, int type, int count)
 {
-    void *pixels = NULL;
-
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, texture.id);
+    if (location == -1) return;
 
-    // NOTE: Using texture.id, we can retrieve some texture info (but not on OpenGL ES 2.0)
-    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
-    //int width, height, format;
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    int size = 0;
 
-    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
-    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
-    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
-    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    switch (type)
+    {
+        case UNIFORM_FLOAT:
+        case UNIFORM_INT:
+        case UNIFORM_SAMPLER2D: size = 4*count; break;
+        case UNIFORM_VEC2:
+        case UNIFORM_IVEC2: size = 8*count; break;
+        case UNIFORM_VEC3:
+        case UNIFORM_IVEC3: size = 12*count; break;
+        case UNIFORM_VEC4:
+        case UNIFORM_IVEC4: size = 16*count; break;
+        case UNIFORM_MATRIX: size = 64*count; break;
+        default: break;
+    }
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(texture.format, &glInternalFormat, &glFormat, &glType);
-    unsigned int size = GetPixelDataSize(texture.width, texture.height, texture.format);
+    // NOTE: Shaders loaded by rlgl always have a uniforms cache, a shader without it has been unloaded
+    // (Shader copies are kept by user) and its locations array is not valid anymore
+    ShaderUniforms *cache = GetShaderUniforms(shader.id);
 
-    if ((glInternalFormat != -1) && (texture.format < COMPRESSED_DXT1_RGB))
+    if (cache == NULL)
     {
-        pixels = (unsigned char *)RL_MALLOC(size);
-        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+        TraceLog(LOG_WARNING, "[SHDR ID %i] Shader not loaded, uniform value could not be set", shader.id);
+        return;
     }
-    else TraceLog(LOG_WARNING, "Texture data retrieval not suported for pixel format");
-
-    glBindTexture(GL_TEXTURE_2D, 0);
-#endif
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // glGetTexImage() is not available on OpenGL ES 2.0
-    // Texture2D width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
-    // Two possible Options:
-    // 1 - Bind texture to color fbo attachment and glReadPixels()
-    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
-    // We are using Option 1, just need to care for texture format on retrieval
-    // NOTE: This behaviour could be conditioned by graphic driver...
-    RenderTexture2D fbo = rlLoadRenderTexture(texture.width, texture.height, UNCOMPRESSED_R8G8B8A8, 16, false);
+    bool builtin = (shader.locs != NULL) && ((location == shader.locs[LOC_MATRIX_MVP]) ||
+                   (location == shader.locs[LOC_COLOR_DIFFUSE]) || (location == shader.locs[LOC_MAP_DIFFUSE]));
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo.id);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    ShaderUniform *uniform = builtin? NULL : GetShaderUniform(cache, NULL, location);
 
-    // Attach our texture to FBO
-    // NOTE: Previoust attached texture is automatically detached
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.id, 0);
+    if ((uniform == NULL) || (size <= 0) || (size > MAX_UNIFORM_VALUE_SIZE))
+    {
+        // Value is uploaded now, pending draws using the shader are drawn first with previous values
+        if (CheckShaderPending(shader.id)) rlglDraw();
 
-    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
-    pixels = (unsigned char *)RL_MALLOC(GetPixelDataSize(texture.width, texture.height, UNCOMPRESSED_R8G8B8A8));
-    glReadPixels(0, 0, texture.width, texture.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        // Pending values are uploaded first to keep writes order
+        if (!builtin) FlushShaderUniforms(shader);
 
-    // Re-attach internal FBO color texture before deleting it
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, fbo.texture.id, 0);
+        SetStateProgram(shader.id);
+        ResetStateUniform(shader, location);
+        UploadShaderUniform(location, value, type, count);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        // Uploaded value is not kept: location could also be an element of a cached array uniform
+        if (uniform != NULL) uniform->uploaded = false;
+        else if (!builtin)
+        {
+            for (int i = 0; i < cache->uniformsCount; i++)
+            {
+                if (cache->uniforms[i].count > 1) cache->uniforms[i].uploaded = false;
+            }
+        }
 
-    // Clean up temporal fbo
-    rlDeleteRenderTextures(fbo);
-#endif
+        return;
+    }
 
-    return pixels;
-}
+    if ((uniform->dirty || uniform->uploaded) && (uniform->type == type) && (uniform->count == count) &&
+        (memcmp(uniform->value, value, size) == 0)) frameStats.uniformsSkipped++;
+    else
+    {
+        // Uniform values are not kept per draw call, pending draws using the shader are drawn with previous value
+        if (CheckShaderPending(shader.id)) rlglDraw();
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Shaders Functions
-// NOTE: Those functions are exposed directly to the user in raylib.h
-//----------------------------------------------------------------------------------
+        memcpy(uniform->value, value, size);
+        uniform->type = type;
+        uniform->count = count;
+        uniform->uploaded = false;
 
-// Get default internal texture (white texture)
-Texture2D GetTextureDefault(void)
-{
-    Texture2D texture = { 0 };
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    texture.id = defaultTextureId;
-    texture.width = 1;
-    texture.height = 1;
-    texture.mipmaps = 1;
-    texture.format = UNCOMPRESSED_R8G8B8A8;
-#endif
-    return texture;
+        if (!uniform->dirty)
+        {
+            uniform->dirty = true;
+            cache->dirty[cache->dirtyCount] = (int)(uniform - cache->uniforms);
+            cache->dirtyCount++;
+        }
+    }
 }
 
-// Get default shader
-Shader GetShaderDefault(void)
+// Upload uniform value to shader program in use
+static void UploadShaderUniform(int location, const void *value, int type, int count)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    return defaultShader;
-#else
-    Shader shader = { 0 };
-    return shader;
-#endif
+    switch (type)
+    {
+        case UNIFORM_FLOAT: glUniform1fv(location, count, (float *)value); break;
+        case UNIFORM_VEC2: glUniform2fv(location, count, (float *)value); break;
+        case UNIFORM_VEC3: glUniform3fv(location, count, (float *)value); break;
+        case UNIFORM_VEC4: glUniform4fv(location, count, (float *)value); break;
+        case UNIFORM_INT: glUniform1iv(location, count, (int *)value); break;
+        case UNIFORM_IVEC2: glUniform2iv(location, count, (int *)value); break;
+        case UNIFORM_IVEC3: glUniform3iv(location, count, (int *)value); break;
+        case UNIFORM_IVEC4: glUniform4iv(location, count, (int *)value); break;
+        case UNIFORM_SAMPLER2D: glUniform1iv(location, count, (int *)value); break;
+        case UNIFORM_MATRIX: glUniformMatrix4fv(location, count, false, (float *)value); break;
+        default: TraceLog(LOG_WARNING, "Shader uniform could not be set data type not recognized");
+    }
 }
 
-// Load text data from file
-// NOTE: text chars array should be freed manually
-char *LoadText(const char *fileName)
+// Upload shader staged uniform values (shader program is set in use)
+// NOTE: Called before drawing with the shader
+static void FlushShaderUniforms(Shader shader)
 {
-    FILE *textFile = NULL;
-    char *text = NULL;
+    ShaderUniforms *cache = GetShaderUniforms(shader.id);
 
-    if (fileName != NULL)
-    {
-        textFile = fopen(fileName,"rt");
+    if ((cache == NULL) || (cache->dirtyCount == 0)) return;
 
-        if (textFile != NULL)
-        {
-            fseek(textFile, 0, SEEK_END);
-            int size = ftell(textFile);
-            fseek(textFile, 0, SEEK_SET);
+    SetStateProgram(shader.id);
 
-            if (size > 0)
-            {
-                text = (char *)RL_MALLOC(sizeof(char)*(size + 1));
-                int count = fread(text, sizeof(char), size, textFile);
-                text[count] = '\0';
-            }
+    for (int i = 0; i < cache->dirtyCount; i++)
+    {
+        ShaderUniform *uniform = &cache->uniforms[cache->dirty[i]];
 
-            fclose(textFile);
-        }
-        else TraceLog(LOG_WARNING, "[%s] Text file could not be opened", fileName);
+        UploadShaderUniform(uniform->location, uniform->value, uniform->type, uniform->count);
+        uniform->dirty = false;
+        uniform->uploaded = true;
     }
 
-    return text;
+    cache->dirtyCount = 0;
 }
 
-// Load shader from files and bind default locations
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-Shader LoadShader(const char *vsFileName, const char *fsFileName)
+// Check shader is used by batch draw calls not drawn yet
+static bool CheckShaderPending(unsigned int id)
 {
-    Shader shader = { 0 };
+    for (int i = 0; i < drawsCounter; i++)
+    {
+        if ((draws[i].vertexCount > 0) && (draws[i].shader.id == id)) return true;
+    }
 
-    // NOTE: Shader.locs is allocated by LoadShaderCode()
+    return false;
+}
 
-    char *vShaderStr = NULL;
-    char *fShaderStr = NULL;
+// Unload default shader
+static void UnloadShaderDefault(void)
+{
+    SetStateProgram(0);
 
-    if (vsFileName != NULL) vShaderStr = LoadText(vsFileName);
-    if (fsFileName != NULL) fShaderStr = LoadText(fsFileName);
+    // NOTE: Default shader program uses batch shaders, deleted with the program
+    glDeleteShader(defaultVShaderId);
+    glDeleteShader(defaultFShaderId);
 
-    shader = LoadShaderCode(vShaderStr, fShaderStr);
+    glDeleteProgram(defaultShader.id);
 
-    if (vShaderStr != NULL) RL_FREE(vShaderStr);
-    if (fShaderStr != NULL) RL_FREE(fShaderStr);
+    UnloadShaderUniforms(defaultShader.id);
 
-    return shader;
+    if (stereoShader.id > 0) glDeleteProgram(stereoShader.id);
+    RL_FREE(stereoShader.locs);
+    stereoShader.id = 0;
+    stereoShader.locs = NULL;
 }
 
-// Load shader from code strings
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-Shader LoadShaderCode(const char *vsCode, const char *fsCode)
+// Load default internal buffers
+static void LoadBuffersDefault(void)
 {
-    Shader shader = { 0 };
-    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+    // Initialize CPU (RAM) arrays (interleaved vertex data and indexes)
+    //--------------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+    {
+        vertexData[i].vertices = (BatchVertex *)RL_CALLOC(4*batchElements, sizeof(BatchVertex));     // 4 vertex by quad
+#if defined(GRAPHICS_API_OPENGL_33)
+        vertexData[i].indices = (unsigned int *)RL_MALLOC(sizeof(unsigned int)*6*batchElements);      // 6 int by quad (indices)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        vertexData[i].indices = (unsigned short *)RL_MALLOC(sizeof(unsigned short)*6*batchElements);  // 6 int by quad (indices)
+#endif
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+        int k = 0;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int vertexShaderId = defaultVShaderId;
-    unsigned int fragmentShaderId = defaultFShaderId;
+        // Indices can be initialized right now
+        for (int j = 0; j < (6*batchElements); j += 6)
+        {
+            vertexData[i].indices[j] = 4*k;
+            vertexData[i].indices[j + 1] = 4*k + 1;
+            vertexData[i].indices[j + 2] = 4*k + 2;
+            vertexData[i].indices[j + 3] = 4*k;
+            vertexData[i].indices[j + 4] = 4*k + 2;
+            vertexData[i].indices[j + 5] = 4*k + 3;
 
-    if (vsCode != NULL) vertexShaderId = CompileShader(vsCode, GL_VERTEX_SHADER);
-    if (fsCode != NULL) fragmentShaderId = CompileShader(fsCode, GL_FRAGMENT_SHADER);
+            k++;
+        }
 
-    if ((vertexShaderId == defaultVShaderId) && (fragmentShaderId == defaultFShaderId)) shader = defaultShader;
-    else
-    {
-        shader.id = LoadShaderProgram(vertexShaderId, fragmentShaderId);
+        vertexData[i].vCounter = 0;
+    }
 
-        if (vertexShaderId != defaultVShaderId) glDeleteShader(vertexShaderId);
-        if (fragmentShaderId != defaultFShaderId) glDeleteShader(fragmentShaderId);
+    // Deferred mode requires an additional array to reorder vertex data
+    if (deferredMode) mergeVertices = (BatchVertex *)RL_CALLOC(4*batchElements, sizeof(BatchVertex));
 
-        if (shader.id == 0)
+    TraceLog(LOG_INFO, "Internal buffers initialized successfully (CPU)");
+    //--------------------------------------------------------------------------------------------
+
+    // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
+    //--------------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+    {
+        if (vaoSupported)
         {
-            TraceLog(LOG_WARNING, "Custom shader could not be loaded");
-            shader = defaultShader;
+            // Initialize Quads VAO
+            glGenVertexArrays(1, &vertexData[i].vaoId);
+            SetStateVertexArray(vertexData[i].vaoId);
         }
 
-        // After shader loading, we TRY to set default location names
-        if (shader.id > 0) SetShaderDefaultLocations(&shader);
+        // Quads - Vertex buffer binding and attributes enable
+        // Interleaved vertex buffer: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+        glGenBuffers(1, &vertexData[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[0]);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+        if (bufferStorageSupported)
+        {
+            // Immutable storage, mapped once and kept mapped while rlgl is alive
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_ARRAY_BUFFER, sizeof(BatchVertex)*4*batchElements, NULL, flags);
+            vertexData[i].mappedVertices = (BatchVertex *)glMapBufferRange(GL_ARRAY_BUFFER, 0, sizeof(BatchVertex)*4*batchElements, flags);
+
+            if (vertexData[i].mappedVertices == NULL)
+            {
+                // Immutable storage can not be orphaned, recreate buffer to use the fallback path
+                TraceLog(LOG_WARNING, "Batch buffer could not be mapped, using buffer orphaning");
+                glDeleteBuffers(1, &vertexData[i].vboId[0]);
+                glGenBuffers(1, &vertexData[i].vboId[0]);
+                glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[0]);
+            }
+        }
+
+        if (vertexData[i].mappedVertices == NULL)
+#endif
+        glBufferData(GL_ARRAY_BUFFER, sizeof(BatchVertex)*4*batchElements, vertexData[i].vertices, GL_DYNAMIC_DRAW);
+        SetBufferAttribsDefault();
+
+        // Fill index buffer
+        glGenBuffers(1, &vertexData[i].vboId[1]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexData[i].vboId[1]);
+#if defined(GRAPHICS_API_OPENGL_33)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int)*6*batchElements, vertexData[i].indices, GL_STATIC_DRAW);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(short)*6*batchElements, vertexData[i].indices, GL_STATIC_DRAW);
+#endif
     }
 
-    // Get available shader uniforms
-    // NOTE: This information is useful for debug...
-    int uniformCount = -1;
+    TraceLog(LOG_INFO, "Internal buffers uploaded successfully (GPU)");
 
-    glGetProgramiv(shader.id, GL_ACTIVE_UNIFORMS, &uniformCount);
+    // Unbind the current VAO
+    if (vaoSupported) SetStateVertexArray(0);
+    //--------------------------------------------------------------------------------------------
+}
 
-    for (int i = 0; i < uniformCount; i++)
+// Update default internal buffers (VAOs/VBOs) with vertex array data
+// NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
+// TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
+static void UpdateBuffersDefault(void)
+{
+    // Update vertex buffers data
+    if (vertexData[currentBuffer].vCounter > 0)
     {
-        int namelen = -1;
-        int num = -1;
-        char name[256]; // Assume no variable names longer than 256
-        GLenum type = GL_ZERO;
+        frameStats.bytesUploaded += sizeof(BatchVertex)*vertexData[currentBuffer].vCounter;
 
-        // Get the name of the uniforms
-        glGetActiveUniform(shader.id, i,sizeof(name) - 1, &namelen, &num, &type, name);
+        // Activate elements VAO
+        if (vaoSupported) SetStateVertexArray(vertexData[currentBuffer].vaoId);
+
+        // Interleaved vertex data buffer (position + texcoords + colors), uploaded with a single call
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+        if (vertexData[currentBuffer].mappedVertices != NULL)
+        {
+            // Make sure GPU is not reading this buffer anymore (it was used MAX_BATCH_BUFFERING draws ago)
+            if (vertexData[currentBuffer].fence != NULL)
+            {
+                GLsync fence = (GLsync)vertexData[currentBuffer].fence;
 
-        name[namelen] = 0;
+                if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+                {
+                    fenceWaitCounter++;
+                    while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) { }
+                }
 
-        // Get the location of the named uniform
-        unsigned int location = glGetUniformLocation(shader.id, name);
+                glDeleteSync(fence);
+                vertexData[currentBuffer].fence = NULL;
+            }
 
-        TraceLog(LOG_DEBUG, "[SHDR ID %i] Active uniform [%s] set at location: %i", shader.id, name, location);
-    }
+            // NOTE: Buffer is mapped coherent, no flush or unmap required
+            memcpy(vertexData[currentBuffer].mappedVertices, vertexData[currentBuffer].vertices, sizeof(BatchVertex)*vertexData[currentBuffer].vCounter);
+        }
+        else
 #endif
+        {
+            // Orphan previous buffer storage, driver provides a new one if GPU is still using it
+            glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(BatchVertex)*4*batchElements, NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(BatchVertex)*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].vertices);
+        }
 
-    return shader;
+        // Unbind the current VAO
+        if (vaoSupported) SetStateVertexArray(0);
+    }
 }
 
-// Unload shader from GPU memory (VRAM)
-void UnloadShader(Shader shader)
+// Set default internal buffers vertex attributes for the currently bound vertex buffer
+// NOTE: Vertex data is interleaved, all attributes share the same buffer with a BatchVertex stride
+static void SetBufferAttribsDefault(void)
 {
-    if (shader.id > 0)
+    // NOTE: Default shader locations are used, custom shaders get default attributes binded to same locations
+    // on linkage (LoadShaderProgram()), current shader could have missing locations (-1)
+    glVertexAttribPointer(defaultShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(BatchVertex), (void *)0);
+    glEnableVertexAttribArray(defaultShader.locs[LOC_VERTEX_POSITION]);
+
+    glVertexAttribPointer(defaultShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(BatchVertex), (void *)(3*sizeof(float)));
+    glEnableVertexAttribArray(defaultShader.locs[LOC_VERTEX_TEXCOORD01]);
+
+    glVertexAttribPointer(defaultShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(BatchVertex), (void *)(5*sizeof(float)));
+    glEnableVertexAttribArray(defaultShader.locs[LOC_VERTEX_COLOR]);
+
+    // NOTE: Texture slot is provided as float attribute (not normalized), integer attributes not supported on OpenGL ES2
+    if (defaultTexSlotLoc != -1)
     {
-        rlDeleteShader(shader.id);
-        TraceLog(LOG_INFO, "[SHDR ID %i] Unloaded shader program data", shader.id);
+        glVertexAttribPointer(defaultTexSlotLoc, 1, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(BatchVertex), (void *)(5*sizeof(float) + 4));
+        glEnableVertexAttribArray(defaultTexSlotLoc);
     }
-
-    RL_FREE(shader.locs);
 }
 
-// Begin custom shader mode
-void BeginShaderMode(Shader shader)
+// Set stereo eye viewport and matrices, used when eyes are drawn in separate passes
+// NOTE: Eye view offset is applied to provided modelview, matrices are restored by caller
+static void SetStereoEye(int eye, Matrix matModelView)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (currentShader.id != shader.id)
-    {
-        rlglDraw();
-        currentShader = shader;
-    }
-#endif
+    glViewport(stereoViewport[eye][0], stereoViewport[eye][1], stereoViewport[eye][2], stereoViewport[eye][3]);
+
+    projection = stereoProjection[eye];
+    modelview = MatrixMultiply(matModelView, stereoViewOffset[eye]);
 }
 
-// End custom shader mode (returns to default shader)
-void EndShaderMode(void)
+// Set viewport covering both stereo eyes (from left eye origin to right eye end)
+static void ResetStereoViewport(void)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    BeginShaderMode(defaultShader);
-#endif
+    glViewport(stereoViewport[0][0], stereoViewport[0][1], stereoViewport[1][0] + stereoViewport[1][2] - stereoViewport[0][0], stereoViewport[0][3]);
 }
 
-// Get shader uniform location
-int GetShaderLocation(Shader shader, const char *uniformName)
+// Draw default internal buffers vertex data
+static void DrawBuffersDefault(void)
 {
-    int location = -1;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetUniformLocation(shader.id, uniformName);
+    Matrix matProjection = projection;
+    Matrix matModelView = modelview;
 
-    if (location == -1) TraceLog(LOG_WARNING, "[SHDR ID %i][%s] Shader uniform could not be found", shader.id, uniformName);
-    else TraceLog(LOG_INFO, "[SHDR ID %i][%s] Shader uniform set at location: %i", shader.id, uniformName, location);
+    rlBeginGpuTimer(RL_GPU_TIMER_FLUSH);
+
+#if defined(GRAPHICS_API_NONE)
+    // Record batch flush, draw calls are not recorded again by the recording OpenGL layer
+    if (vertexData[currentBuffer].vCounter > 0) RecordBatchFlush(MatrixMultiply(modelview, projection));
+    recordBatchDrawing = true;
 #endif
-    return location;
-}
 
-// Set shader uniform value
-void SetShaderValue(Shader shader, int uniformLoc, const void *value, int uniformType)
-{
-    SetShaderValueV(shader, uniformLoc, value, uniformType, 1);
-}
+    // Stereo rendering: both eyes are drawn in a single pass if every draw call uses default shader
+    // and eyes viewports are side by side, otherwise batch is drawn once per eye
+    int eyesCount = 1;
+    bool stereoSinglePass = false;
 
-// Set shader uniform value vector
-void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int uniformType, int count)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
-
-    switch (uniformType)
-    {
-        case UNIFORM_FLOAT: glUniform1fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC2: glUniform2fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC3: glUniform3fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC4: glUniform4fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_INT: glUniform1iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC2: glUniform2iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC3: glUniform3iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC4: glUniform4iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_SAMPLER2D: glUniform1iv(uniformLoc, count, (int *)value); break;
-        default: TraceLog(LOG_WARNING, "Shader uniform could not be set data type not recognized");
+    if (stereoRender)
+    {
+        stereoSinglePass = (stereoShader.id > 0) && (stereoViewport[1][0] == (stereoViewport[0][0] + stereoViewport[0][2])) &&
+                           (stereoViewport[1][1] == stereoViewport[0][1]) && (stereoViewport[1][2] == stereoViewport[0][2]) &&
+                           (stereoViewport[1][3] == stereoViewport[0][3]);
+
+        for (int i = 0; (i < drawsCounter) && stereoSinglePass; i++)
+        {
+            if ((draws[i].vertexCount > 0) && (draws[i].shader.id != defaultShader.id)) stereoSinglePass = false;
+        }
+
+        if (!stereoSinglePass) eyesCount = 2;
     }
 
-    //glUseProgram(0);      // Avoid reseting current shader program, in case other uniforms are set
-#endif
-}
+    for (int eye = 0; eye < eyesCount; eye++)
+    {
+        if (eyesCount == 2) SetStereoEye(eye, matModelView);
 
+        // Draw buffers
+        if (vertexData[currentBuffer].vCounter > 0)
+        {
+            // Create modelview-projection matrix
+            Matrix matMVP = MatrixMultiply(modelview, projection);
 
-// Set shader uniform value (matrix 4x4)
-void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
+            // Create eyes modelview-projection matrices (single pass stereo), eye view is selected by instance
+            float eyesMVP[32] = { 0 };
 
-    glUniformMatrix4fv(uniformLoc, 1, false, MatrixToFloat(mat));
+            if (stereoSinglePass)
+            {
+                for (int k = 0; k < 2; k++)
+                {
+                    float16 eyeMVP = MatrixToFloatV(MatrixMultiply(MatrixMultiply(modelview, stereoViewOffset[k]), stereoProjection[k]));
+                    memcpy(eyesMVP + 16*k, eyeMVP.v, 16*sizeof(float));
+                }
 
-    //glUseProgram(0);
+                ResetStereoViewport();
+#if defined(GRAPHICS_API_OPENGL_33)
+                glEnable(GL_CLIP_DISTANCE0);
+                glEnable(GL_CLIP_DISTANCE1);
 #endif
-}
+            }
 
-// Set shader uniform value for texture
-void SetShaderValueTexture(Shader shader, int uniformLoc, Texture2D texture)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
+            // Draw state currently applied, every draw call state is only set if it changes
+            // NOTE: First draw always sets the full state (-1 means unknown)
+            unsigned int drawShaderId = 0;
+            int drawBlendMode = -1;
+            int drawScissorEnabled = -1;
+            int drawScissorRec[4] = { 0 };
+            int drawDepthMask = -1;
 
-    glUniform1i(uniformLoc, texture.id);
+            // Depth sort mode: draws are depth tested, opaque draws write depth (set per draw)
+            if (depthSortMode && !depthTestEnabled) glEnable(GL_DEPTH_TEST);
 
-    //glUseProgram(0);
-#endif
-}
+            // TODO: Support additional texture units on custom shader
+            //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) glUniform1i(currentShader.locs[LOC_MAP_SPECULAR], 1);
+            //if (currentShader->locs[LOC_MAP_NORMAL] > 0) glUniform1i(currentShader.locs[LOC_MAP_NORMAL], 2);
 
-// Set a custom projection matrix (replaces internal projection matrix)
-void SetMatrixProjection(Matrix proj)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    projection = proj;
-#endif
-}
+            // NOTE: Right now additional map textures not considered for default buffers drawing
 
-// Return internal projection matrix
-Matrix GetMatrixProjection(void) {
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_PROJECTION_MATRIX,mat);
-    Matrix m;
-    m.m0  = mat[0];     m.m1  = mat[1];     m.m2  = mat[2];     m.m3  = mat[3];
-    m.m4  = mat[4];     m.m5  = mat[5];     m.m6  = mat[6];     m.m7  = mat[7];
-    m.m8  = mat[8];     m.m9  = mat[9];     m.m10 = mat[10];    m.m11 = mat[11];
-    m.m12 = mat[12];    m.m13 = mat[13];    m.m14 = mat[14];    m.m15 = mat[15];
-    return m;
-#else
-    return projection;
-#endif
-#
-}
+            int vertexOffset = 0;
 
-// Set a custom modelview matrix (replaces internal modelview matrix)
-void SetMatrixModelview(Matrix view)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    modelview = view;
-#endif
-}
+            if (vaoSupported) SetStateVertexArray(vertexData[currentBuffer].vaoId);
+            else
+            {
+                // Bind vertex attribs: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+                glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
+                SetBufferAttribsDefault();
 
-// Return internal modelview matrix
-Matrix GetMatrixModelview(void)
-{
-    Matrix matrix = MatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
-    matrix.m0  = mat[0];     matrix.m1  = mat[1];     matrix.m2  = mat[2];     matrix.m3  = mat[3];
-    matrix.m4  = mat[4];     matrix.m5  = mat[5];     matrix.m6  = mat[6];     matrix.m7  = mat[7];
-    matrix.m8  = mat[8];     matrix.m9  = mat[9];     matrix.m10 = mat[10];    matrix.m11 = mat[11];
-    matrix.m12 = mat[12];    matrix.m13 = mat[13];    matrix.m14 = mat[14];    matrix.m15 = mat[15];
-#else
-    matrix = modelview;
-#endif
-    return matrix;
-}
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexData[currentBuffer].vboId[1]);
+            }
 
-// Generate cubemap texture from HDR texture
-// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
-Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size)
-{
-    Texture2D cubemap = { 0 };
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
-    // Other locations should be setup externally in shader before calling the function
+            for (int i = 0; i < drawsCounter; i++)
+            {
+                // Empty draws (state changes without vertex) only need to be skipped
+                if (draws[i].vertexCount == 0)
+                {
+                    vertexOffset += draws[i].vertexAlignment;
+                    continue;
+                }
 
-    // Set up depth face culling and cubemap seamless
-    glDisable(GL_CULL_FACE);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);     // Flag not supported on OpenGL ES 2.0
-#endif
+                // Set draw shader, upload staged uniforms and current MVP matrix
+                // NOTE: Shader program and uniforms are only set if they changed since last use (GL state cache)
+                if (draws[i].shader.id != drawShaderId)
+                {
+                    if (stereoSinglePass)
+                    {
+                        // NOTE: Default shader is replaced by its stereo variant (samplers set on load)
+                        SetStateProgram(stereoShader.id);
+                        glUniformMatrix4fv(stereoShader.locs[LOC_MATRIX_MVP], 2, false, eyesMVP);
+                        SetStateUniformColor(stereoShader, 1.0f, 1.0f, 1.0f, 1.0f);
+                    }
+                    else
+                    {
+                        SetStateProgram(draws[i].shader.id);
+                        FlushShaderUniforms(draws[i].shader);
+                        SetStateUniformMvp(draws[i].shader, matMVP);
+                        SetStateUniformColor(draws[i].shader, 1.0f, 1.0f, 1.0f, 1.0f);
+                        SetStateUniformSampler(draws[i].shader, 0);    // Provided value refers to the texture unit (active)
+                    }
+
+                    drawShaderId = draws[i].shader.id;
+                }
 
-    // Setup framebuffer
-    unsigned int fbo, rbo;
-    glGenFramebuffers(1, &fbo);
-    glGenRenderbuffers(1, &rbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
-#endif
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+                // Set draw blending mode
+                if (draws[i].blendMode != drawBlendMode)
+                {
+                    SetBlendMode(draws[i].blendMode);
+                    drawBlendMode = draws[i].blendMode;
+                }
 
-    // Set up cubemap to render and attach to framebuffer
-    // NOTE: Faces are stored as 32 bit floating point values
-    glGenTextures(1, &cubemap.id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
-    for (unsigned int i = 0; i < 6; i++)
-    {
+                // Set draw scissor test and rectangle
+                if ((int)draws[i].scissorEnabled != drawScissorEnabled)
+                {
+                    if (draws[i].scissorEnabled) glEnable(GL_SCISSOR_TEST);
+                    else glDisable(GL_SCISSOR_TEST);
+
+                    drawScissorEnabled = (int)draws[i].scissorEnabled;
+                }
+
+                if (draws[i].scissorEnabled && ((draws[i].scissorRec[0] != drawScissorRec[0]) || (draws[i].scissorRec[1] != drawScissorRec[1]) ||
+                    (draws[i].scissorRec[2] != drawScissorRec[2]) || (draws[i].scissorRec[3] != drawScissorRec[3])))
+                {
+                    glScissor(draws[i].scissorRec[0], draws[i].scissorRec[1], draws[i].scissorRec[2], draws[i].scissorRec[3]);
+                    for (int k = 0; k < 4; k++) drawScissorRec[k] = draws[i].scissorRec[k];
+                }
+
+                // Set draw depth writes (depth sort mode)
+                if (depthSortMode && ((int)draws[i].opaque != drawDepthMask))
+                {
+                    glDepthMask(draws[i].opaque);
+                    drawDepthMask = (int)draws[i].opaque;
+                }
+
+                // Bind draw textures, one per texture unit (only if changed, GL state cache)
+                for (int k = 0; k < draws[i].texturesCount; k++)
+                {
+                    if (SetStateTexture(k, draws[i].textures[k])) frameStats.textureBinds++;
+                }
+
+                // TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
+                //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
+                //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
+
+                frameStats.drawCalls++;
+
+                if ((draws[i].mode == RL_LINES) || (draws[i].mode == RL_TRIANGLES))
+                {
 #if defined(GRAPHICS_API_OPENGL_33)
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB32F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+                    if (stereoSinglePass) glDrawArraysInstanced(draws[i].mode, vertexOffset, draws[i].vertexCount, 2);
+                    else glDrawArrays(draws[i].mode, vertexOffset, draws[i].vertexCount);
 #elif defined(GRAPHICS_API_OPENGL_ES2)
-        if (texFloatSupported) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+                    // NOTE: Single pass stereo is not supported on OpenGL ES 2.0 (no stereo shader)
+                    glDrawArrays(draws[i].mode, vertexOffset, draws[i].vertexCount);
 #endif
-    }
-
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                }
+                else
+                {
 #if defined(GRAPHICS_API_OPENGL_33)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+                    // We need to define the number of indices to be processed: quadsCount*6
+                    // NOTE: The final parameter tells the GPU the offset in bytes from the
+                    // start of the index buffer to the location of the first index to process
+                    if (stereoSinglePass) glDrawElementsInstanced(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6), 2);
+                    else glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6));
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+                    glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(sizeof(GLushort)*vertexOffset/4*6));
 #endif
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    // Create projection and different views for each face
-    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, 0.01, 1000.0);
-    Matrix fboViews[6] = {
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
-    };
-
-    // Convert HDR equirectangular environment map to cubemap equivalent
-    glUseProgram(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, map.id);
-    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+                }
 
-    // Note: don't forget to configure the viewport to the capture dimensions
-    glViewport(0, 0, size, size);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+                vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+            }
 
-    for (int i = 0; i < 6; i++)
-    {
-        SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, cubemap.id, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        GenDrawCube();
-    }
+            if (!vaoSupported)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+            }
 
-    // Unbind framebuffer and textures
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            // Restore current blending and scissor state for non-batched drawing
+            if ((drawBlendMode != -1) && (drawBlendMode != blendMode)) SetBlendMode(blendMode);
+            if ((drawScissorEnabled != -1) && (drawScissorEnabled != (int)scissorEnabled))
+            {
+                if (scissorEnabled) glEnable(GL_SCISSOR_TEST);
+                else glDisable(GL_SCISSOR_TEST);
+            }
+            if (scissorEnabled && (drawScissorEnabled != -1)) glScissor(scissorRec[0], scissorRec[1], scissorRec[2], scissorRec[3]);
 
-    // Reset viewport dimensions to default
-    glViewport(0, 0, framebufferWidth, framebufferHeight);
-    //glEnable(GL_CULL_FACE);
+            // Restore depth writes and depth test state
+            if (drawDepthMask == 0) glDepthMask(GL_TRUE);
+            if (depthSortMode && !depthTestEnabled) glDisable(GL_DEPTH_TEST);
 
-    // NOTE: Texture2D is a GL_TEXTURE_CUBE_MAP, not a GL_TEXTURE_2D!
-    cubemap.width = size;
-    cubemap.height = size;
-    cubemap.mipmaps = 1;
-    cubemap.format = UNCOMPRESSED_R32G32B32;
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (stereoSinglePass)
+            {
+                glDisable(GL_CLIP_DISTANCE0);
+                glDisable(GL_CLIP_DISTANCE1);
+            }
 #endif
-    return cubemap;
-}
-
-// Generate irradiance texture using cubemap data
-// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
-Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
-{
-    Texture2D irradiance = { 0 };
+        }
 
-#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
-    // Other locations should be setup externally in shader before calling the function
+        // NOTE: Shader program and textures are kept bound (tracked by GL state cache),
+        // textures are unbound when render target changes (rlEnableRenderTexture())
+        if (vaoSupported) SetStateVertexArray(0); // Unbind VAO
+    }
 
-    // Setup framebuffer
-    unsigned int fbo, rbo;
-    glGenFramebuffers(1, &fbo);
-    glGenRenderbuffers(1, &rbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+#if defined(GRAPHICS_API_NONE)
+    recordBatchDrawing = false;
+#endif
 
-    // Create an irradiance cubemap, and re-scale capture FBO to irradiance scale
-    glGenTextures(1, &irradiance.id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, irradiance.id);
-    for (unsigned int i = 0; i < 6; i++)
-    {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-    }
+    // Restore viewport covering both eyes
+    if (stereoRender) ResetStereoViewport();
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    rlEndGpuTimer(RL_GPU_TIMER_FLUSH);
 
-    // Create projection (transposed) and different views for each face
-    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, 0.01, 1000.0);
-    Matrix fboViews[6] = {
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
-    };
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    // Signal when GPU is done with this buffer, checked before next upload to it
+    if (vertexData[currentBuffer].mappedVertices != NULL) vertexData[currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
 
-    // Solve diffuse integral by convolution to create an irradiance cubemap
-    glUseProgram(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
-    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+    // Reset vertex counters for next frame
+    vertexData[currentBuffer].vCounter = 0;
 
-    // Note: don't forget to configure the viewport to the capture dimensions
-    glViewport(0, 0, size, size);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    // Reset depth for next draw
+    // NOTE: On depth sort mode layers depth steps are kept until depth buffer is cleared (rlClearScreenBuffers())
+    currentDepth = GetBaseDepth();
 
-    for (int i = 0; i < 6; i++)
-    {
-        SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, irradiance.id, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        GenDrawCube();
-    }
+    // Restore projection/modelview matrices
+    projection = matProjection;
+    modelview = matModelView;
 
-    // Unbind framebuffer and textures
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // Reset draws array, using current draw state
+    ResetDrawCalls(0);
 
-    // Reset viewport dimensions to default
-    glViewport(0, 0, framebufferWidth, framebufferHeight);
+    drawsCounter = 1;
+    currentTexSlot = 0;
 
-    irradiance.width = size;
-    irradiance.height = size;
-    irradiance.mipmaps = 1;
-    //irradiance.format = UNCOMPRESSED_R16G16B16;
-#endif
-    return irradiance;
+    // Change to next buffer in the list
+    currentBuffer++;
+    if (currentBuffer >= MAX_BATCH_BUFFERING) currentBuffer = 0;
 }
 
-// Generate prefilter texture using cubemap data
-// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
-Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
+// Capture current buffer vertex data and draw calls into static batch being captured
+// NOTE: Quads are converted to triangles (static batches are drawn without indices),
+// consecutive draw calls sharing state are merged
+static void CaptureStaticBatch(void)
 {
-    Texture2D prefilter = { 0 };
+    StaticBatch *batch = &staticBatches[staticBatchCapture - 1];
+    int vertexOffset = 0;
 
-#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
-    // Other locations should be setup externally in shader before calling the function
-    // TODO: Locations should be taken out of this function... too shader dependant...
-    int roughnessLoc = GetShaderLocation(shader, "roughness");
+    for (int i = 0; i < drawsCounter; i++)
+    {
+        DrawCall *draw = &draws[i];
 
-    // Setup framebuffer
-    unsigned int fbo, rbo;
-    glGenFramebuffers(1, &fbo);
-    glGenRenderbuffers(1, &rbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+        if (draw->vertexCount > 0)
+        {
+            int mode = (draw->mode == RL_QUADS)? RL_TRIANGLES : draw->mode;
+            int count = (draw->mode == RL_QUADS)? draw->vertexCount/4*6 : draw->vertexCount;
 
-    // Create a prefiltered HDR environment map
-    glGenTextures(1, &prefilter.id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, prefilter.id);
-    for (unsigned int i = 0; i < 6; i++)
-    {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-    }
+            if (batch->vertexCount + count > batch->vertexCapacity)
+            {
+                batch->vertexCapacity = (batch->vertexCount + count)*2;
+                batch->vertices = (BatchVertex *)RL_REALLOC(batch->vertices, sizeof(BatchVertex)*batch->vertexCapacity);
+            }
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            const BatchVertex *source = vertexData[currentBuffer].vertices + vertexOffset;
+            BatchVertex *dest = batch->vertices + batch->vertexCount;
 
-    // Generate mipmaps for the prefiltered HDR texture
-    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+            if (draw->mode == RL_QUADS)
+            {
+                // Same triangles than default buffers indices: 0-1-2, 0-2-3
+                for (int k = 0; k < draw->vertexCount/4; k++, source += 4, dest += 6)
+                {
+                    dest[0] = source[0];
+                    dest[1] = source[1];
+                    dest[2] = source[2];
+                    dest[3] = source[0];
+                    dest[4] = source[2];
+                    dest[5] = source[3];
+                }
+            }
+            else memcpy(dest, source, sizeof(BatchVertex)*count);
 
-    // Create projection (transposed) and different views for each face
-    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, 0.01, 1000.0);
-    Matrix fboViews[6] = {
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
-    };
+            StaticDraw *last = (batch->drawsCount > 0)? &batch->draws[batch->drawsCount - 1] : NULL;
 
-    // Prefilter HDR and store data into mipmap levels
-    glUseProgram(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
-    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+            if ((last != NULL) && (last->mode == mode) && (last->shader.id == draw->shader.id) && (last->blendMode == draw->blendMode) &&
+                (last->texturesCount == draw->texturesCount) && (memcmp(last->textures, draw->textures, sizeof(unsigned int)*draw->texturesCount) == 0))
+            {
+                last->vertexCount += count;
+            }
+            else
+            {
+                if (batch->drawsCount >= batch->drawsCapacity)
+                {
+                    batch->drawsCapacity = (batch->drawsCapacity > 0)? 2*batch->drawsCapacity : 8;
+                    batch->draws = (StaticDraw *)RL_REALLOC(batch->draws, sizeof(StaticDraw)*batch->drawsCapacity);
+                }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+                StaticDraw *staticDraw = &batch->draws[batch->drawsCount];
+                memset(staticDraw, 0, sizeof(StaticDraw));
+                staticDraw->mode = mode;
+                staticDraw->vertexOffset = batch->vertexCount;
+                staticDraw->vertexCount = count;
+                for (int k = 0; k < draw->texturesCount; k++) staticDraw->textures[k] = draw->textures[k];
+                staticDraw->texturesCount = draw->texturesCount;
+                staticDraw->shader = draw->shader;
+                staticDraw->blendMode = draw->blendMode;
+
+                batch->drawsCount++;
+            }
 
-    #define MAX_MIPMAP_LEVELS   5   // Max number of prefilter texture mipmaps
+            batch->vertexCount += count;
+        }
 
-    for (int mip = 0; mip < MAX_MIPMAP_LEVELS; mip++)
-    {
-        // Resize framebuffer according to mip-level size.
-        unsigned int mipWidth  = size*(int)powf(0.5f, (float)mip);
-        unsigned int mipHeight = size*(int)powf(0.5f, (float)mip);
+        vertexOffset += (draw->vertexCount + draw->vertexAlignment);
+    }
 
-        glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mipWidth, mipHeight);
-        glViewport(0, 0, mipWidth, mipHeight);
+    // Reset current buffer for next vertex data, same as after drawing
+    vertexData[currentBuffer].vCounter = 0;
+    currentDepth = GetBaseDepth();
+    ResetDrawCalls(0);
+    drawsCounter = 1;
+    currentTexSlot = 0;
+}
 
-        float roughness = (float)mip/(float)(MAX_MIPMAP_LEVELS - 1);
-        glUniform1f(roughnessLoc, roughness);
+// Begin GPU timer frame, resolving submitted frames while results are available
+// NOTE: Oldest frame slot is reused, if its results are still not available they are dropped (never waits for GPU)
+static void BeginGpuTimerFrame(void)
+{
+    // Resolve submitted frames, from oldest
+    // NOTE: GPU completes frames in order, once a frame is not available newer ones are not either
+    for (int i = 0; i < MAX_GPU_TIMER_FRAMES; i++)
+    {
+        GpuTimerFrame *frame = &gpuTimerFrames[(gpuTimerNext + i)%MAX_GPU_TIMER_FRAMES];
 
-        for (int i = 0; i < 6; i++)
+        if (frame->pending)
         {
-            SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, prefilter.id, mip);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-            GenDrawCube();
+            if (ResolveGpuTimerFrame(frame)) frame->pending = false;
+            else break;
         }
     }
 
-    // Unbind framebuffer and textures
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    gpuTimerFramesCounter++;
+    gpuTimerFrame = gpuTimerNext;
+    gpuTimerNext = (gpuTimerNext + 1)%MAX_GPU_TIMER_FRAMES;
 
-    // Reset viewport dimensions to default
-    glViewport(0, 0, framebufferWidth, framebufferHeight);
+    gpuTimerFrames[gpuTimerFrame].sectionsCount = 0;
+    gpuTimerFrames[gpuTimerFrame].lastQuery = 0;
+    gpuTimerFrames[gpuTimerFrame].frameIndex = gpuTimerFramesCounter;
+    gpuTimerFrames[gpuTimerFrame].pending = false;
 
-    prefilter.width = size;
-    prefilter.height = size;
-    //prefilter.mipmaps = 1 + (int)floor(log(size)/log(2));
-    //prefilter.format = UNCOMPRESSED_R16G16B16;
-#endif
-    return prefilter;
+    for (int i = 0; i < RL_GPU_TIMER_COUNT; i++) gpuTimerDepth[i] = 0;
 }
 
-// Generate BRDF texture using cubemap data
-// NOTE: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
-// TODO: Review implementation: https://github.com/HectorMF/BRDFGenerator
-Texture2D GenTextureBRDF(Shader shader, int size)
+// Resolve GPU timer frame results, only if available (never waits for GPU)
+// NOTE: Queries complete in order, if last query submitted for a frame is available all frame queries are
+static bool ResolveGpuTimerFrame(GpuTimerFrame *frame)
 {
-    Texture2D brdf = { 0 };
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Generate BRDF convolution texture
-    glGenTextures(1, &brdf.id);
-    glBindTexture(GL_TEXTURE_2D, brdf.id);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    if (texFloatSupported) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-#endif
+    int available = 0;
+    glGetQueryObjectiv(frame->queries[frame->lastQuery], GL_QUERY_RESULT_AVAILABLE, &available);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    if (!available) return false;
 
-    // Render BRDF LUT into a quad using FBO
-    unsigned int fbo, rbo;
-    glGenFramebuffers(1, &fbo);
-    glGenRenderbuffers(1, &rbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // Timer results are undefined if a disjoint operation occurred (i.e. GPU frequency change), frame dropped
+    int disjoint = 0;
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+
+    if (disjoint) return true;
 #endif
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, brdf.id, 0);
 
-    glViewport(0, 0, size, size);
-    glUseProgram(shader.id);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    GenDrawQuad();
+    double times[RL_GPU_TIMER_COUNT] = { 0 };
+    int sections = 0;
 
-    // Unbind framebuffer and textures
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    for (int i = 0; i < frame->sectionsCount; i++)
+    {
+        if (frame->types[i] == -1) continue;
 
-    // Unload framebuffer but keep color texture
-    glDeleteRenderbuffers(1, &rbo);
-    glDeleteFramebuffers(1, &fbo);
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(frame->queries[i*2], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(frame->queries[i*2 + 1], GL_QUERY_RESULT, &end);
 
-    // Reset viewport dimensions to default
-    glViewport(0, 0, framebufferWidth, framebufferHeight);
+        if (end > begin) times[frame->types[i]] += (double)(end - begin)/1000000000.0;     // Timestamps in nanoseconds
+        sections++;
+    }
 
-    brdf.width = size;
-    brdf.height = size;
-    brdf.mipmaps = 1;
-    brdf.format = UNCOMPRESSED_R32G32B32;
-#endif
-    return brdf;
+    gpuTimings.frameTime = (float)times[RL_GPU_TIMER_FRAME];
+    gpuTimings.flushTime = (float)times[RL_GPU_TIMER_FLUSH];
+    gpuTimings.texturePassTime = (float)times[RL_GPU_TIMER_TEXTURE_PASS];
+    gpuTimings.meshTime = (float)times[RL_GPU_TIMER_MESH];
+    gpuTimings.sections = sections;
+    gpuTimings.latency = (int)(gpuTimerFramesCounter - frame->frameIndex);
+
+    return true;
 }
 
-// Begin blending mode (alpha, additive, multiplied)
-// NOTE: Only 3 blending modes supported, default blend mode is alpha
-void BeginBlendMode(int mode)
+// Close current draw call and register a new one with current draw state (shader, blending, scissor)
+// NOTE: If current draw call has no vertex yet, it's reused and only its state is updated
+static void NewDrawCall(void)
 {
-    if ((blendMode != mode) && (mode < 3))
+    if (draws[drawsCounter - 1].vertexCount > 0)
     {
-        rlglDraw();
+        // Make sure current draws[i].vertexCount is aligned a multiple of 4,
+        // that way, following QUADS drawing will keep aligned with index processing
+        // It implies adding some extra alignment vertex at the end of the draw,
+        // those vertex are not processed but they are considered as an additional offset
+        // for the next set of vertex to be drawn
+        if (draws[drawsCounter - 1].mode == RL_LINES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? draws[drawsCounter - 1].vertexCount : draws[drawsCounter - 1].vertexCount%4);
+        else if (draws[drawsCounter - 1].mode == RL_TRIANGLES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? 1 : (4 - (draws[drawsCounter - 1].vertexCount%4)));
+
+        else draws[drawsCounter - 1].vertexAlignment = 0;
+
+        if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDraw();
+        else
+        {
+            vertexData[currentBuffer].vCounter += draws[drawsCounter - 1].vertexAlignment;
 
-        switch (mode)
+            drawsCounter++;
+            currentTexSlot = 0;
+        }
+    }
+
+    if (drawsCounter >= batchDrawCalls)
+    {
+        if (batchGrowth)
         {
-            case BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
-            case BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); break; // Alternative: glBlendFunc(GL_ONE, GL_ONE);
-            case BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
-            default: break;
+            // Double draw calls limit, new draw calls are reset with current state
+            batchDrawCalls *= 2;
+            draws = (DrawCall *)RL_REALLOC(draws, sizeof(DrawCall)*batchDrawCalls);
+            ResetDrawCalls(drawsCounter);
+        }
+        else
+        {
+            flushReason = FLUSH_REASON_DRAWCALL_LIMIT;
+            rlglDraw();
         }
+    }
 
-        blendMode = mode;
+    draws[drawsCounter - 1].vertexCount = 0;
+    draws[drawsCounter - 1].shader = currentShader;
+    draws[drawsCounter - 1].blendMode = blendMode;
+    draws[drawsCounter - 1].scissorEnabled = scissorEnabled;
+    for (int i = 0; i < 4; i++) draws[drawsCounter - 1].scissorRec[i] = scissorRec[i];
+    draws[drawsCounter - 1].layer = currentLayer;
+
+    // Custom shaders only use one texture (texture unit 0), current one is kept
+    if ((currentShader.id != defaultShader.id) && (draws[drawsCounter - 1].texturesCount > 1))
+    {
+        draws[drawsCounter - 1].textures[0] = draws[drawsCounter - 1].textures[currentTexSlot];
+        draws[drawsCounter - 1].texturesCount = 1;
+        currentTexSlot = 0;
     }
 }
 
-// End blending mode (reset to default: alpha blending)
-void EndBlendMode(void)
+// Register batch vertex to be transformed by current transform matrix on rlglDraw()
+static void AddTransformRun(int start, int count)
 {
-    BeginBlendMode(BLEND_ALPHA);
-}
+    if (transformRunsCounter >= transformRunsCapacity)
+    {
+        transformRunsCapacity = (transformRunsCapacity > 0)? 2*transformRunsCapacity : 256;
+        transformRuns = (TransformRun *)RL_REALLOC(transformRuns, sizeof(TransformRun)*transformRunsCapacity);
+    }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+    transformRuns[transformRunsCounter].start = start;
+    transformRuns[transformRunsCounter].count = count;
+    transformRuns[transformRunsCounter].version = transformVersion;
+    transformRuns[transformRunsCounter].matrix = transformMatrix;
+    transformRunsCounter++;
+}
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-// Compile custom shader and return shader id
-static unsigned int CompileShader(const char *shaderStr, int type)
+// Transform registered vertex runs of current buffer
+static void ApplyTransformRuns(void)
 {
-    unsigned int shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderStr, NULL);
+    for (int i = 0; i < transformRunsCounter; i++)
+    {
+        TransformVertices(&vertexData[currentBuffer].vertices[transformRuns[i].start], transformRuns[i].count, transformRuns[i].matrix, simdTransformVerified);
+    }
 
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    transformRunsCounter = 0;
+}
 
-    if (success != GL_TRUE)
+// Transform vertex positions by a matrix
+// NOTE: SIMD kernels use the same operations order than Vector3Transform() (no fused multiply-add),
+// so results are bit-exact with the scalar path
+static void TransformVertices(BatchVertex *vertices, int count, Matrix mat, bool simd)
+{
+    int i = 0;
+
+    if (simd)
     {
-        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to compile shader...", shader);
-        int maxLength = 0;
-        int length;
-        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+#if defined(__AVX__)
+        // Matrix columns, duplicated in both 128bit lanes: two vertex per iteration
+        __m256 c0 = _mm256_setr_ps(mat.m0, mat.m1, mat.m2, mat.m3, mat.m0, mat.m1, mat.m2, mat.m3);
+        __m256 c1 = _mm256_setr_ps(mat.m4, mat.m5, mat.m6, mat.m7, mat.m4, mat.m5, mat.m6, mat.m7);
+        __m256 c2 = _mm256_setr_ps(mat.m8, mat.m9, mat.m10, mat.m11, mat.m8, mat.m9, mat.m10, mat.m11);
+        __m256 c3 = _mm256_setr_ps(mat.m12, mat.m13, mat.m14, mat.m15, mat.m12, mat.m13, mat.m14, mat.m15);
+
+        for (; i < (count - 1); i += 2)
+        {
+            BatchVertex *v0 = &vertices[i];
+            BatchVertex *v1 = &vertices[i + 1];
 
-#if defined(_MSC_VER)
-        char *log = RL_MALLOC(maxLength);
-#else
-        char log[maxLength];
+            __m256 r = _mm256_mul_ps(c0, _mm256_setr_ps(v0->x, v0->x, v0->x, v0->x, v1->x, v1->x, v1->x, v1->x));
+            r = _mm256_add_ps(r, _mm256_mul_ps(c1, _mm256_setr_ps(v0->y, v0->y, v0->y, v0->y, v1->y, v1->y, v1->y, v1->y)));
+            r = _mm256_add_ps(r, _mm256_mul_ps(c2, _mm256_setr_ps(v0->z, v0->z, v0->z, v0->z, v1->z, v1->z, v1->z, v1->z)));
+            r = _mm256_add_ps(r, c3);
+
+            float result[8];
+            _mm256_storeu_ps(result, r);
+
+            v0->x = result[0]; v0->y = result[1]; v0->z = result[2];
+            v1->x = result[4]; v1->y = result[5]; v1->z = result[6];
+        }
+
+        _mm256_zeroupper();
 #endif
-        glGetShaderInfoLog(shader, maxLength, &length, log);
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        __m128 s0 = _mm_setr_ps(mat.m0, mat.m1, mat.m2, mat.m3);
+        __m128 s1 = _mm_setr_ps(mat.m4, mat.m5, mat.m6, mat.m7);
+        __m128 s2 = _mm_setr_ps(mat.m8, mat.m9, mat.m10, mat.m11);
+        __m128 s3 = _mm_setr_ps(mat.m12, mat.m13, mat.m14, mat.m15);
 
-        TraceLog(LOG_INFO, "%s", log);
+        for (; i < count; i++)
+        {
+            BatchVertex *v = &vertices[i];
 
-#if defined(_MSC_VER)
-        RL_FREE(log);
+            __m128 r = _mm_mul_ps(s0, _mm_set1_ps(v->x));
+            r = _mm_add_ps(r, _mm_mul_ps(s1, _mm_set1_ps(v->y)));
+            r = _mm_add_ps(r, _mm_mul_ps(s2, _mm_set1_ps(v->z)));
+            r = _mm_add_ps(r, s3);
+
+            _mm_storel_pi((__m64 *)&v->x, r);                               // Store x, y
+            _mm_store_ss(&v->z, _mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 2, 2, 2)));    // Store z
+        }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        float32x4_t n0 = { mat.m0, mat.m1, mat.m2, mat.m3 };
+        float32x4_t n1 = { mat.m4, mat.m5, mat.m6, mat.m7 };
+        float32x4_t n2 = { mat.m8, mat.m9, mat.m10, mat.m11 };
+        float32x4_t n3 = { mat.m12, mat.m13, mat.m14, mat.m15 };
+
+        for (; i < count; i++)
+        {
+            BatchVertex *v = &vertices[i];
+
+            // NOTE: Separated multiply and add, vmlaq_f32() could be fused on some targets
+            float32x4_t r = vmulq_n_f32(n0, v->x);
+            r = vaddq_f32(r, vmulq_n_f32(n1, v->y));
+            r = vaddq_f32(r, vmulq_n_f32(n2, v->z));
+            r = vaddq_f32(r, n3);
+
+            v->x = vgetq_lane_f32(r, 0);
+            v->y = vgetq_lane_f32(r, 1);
+            v->z = vgetq_lane_f32(r, 2);
+        }
 #endif
     }
-    else TraceLog(LOG_INFO, "[SHDR ID %i] Shader compiled successfully", shader);
 
-    return shader;
+    // Scalar path (also processes remaining vertex if no SIMD available)
+    for (; i < count; i++)
+    {
+        Vector3 vec = Vector3Transform((Vector3){ vertices[i].x, vertices[i].y, vertices[i].z }, mat);
+
+        vertices[i].x = vec.x;
+        vertices[i].y = vec.y;
+        vertices[i].z = vec.z;
+    }
 }
 
-// Load custom shader strings and return program id
-static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Check SIMD transform kernel is bit-exact with Vector3Transform() (scalar path)
+// NOTE: Verified once on rlglInit(), in case compiler flags allow fused multiply-add on scalar path,
+// odd vertex count (8 + 3) also exercises remaining vertex paths after AVX pairs and SSE/NEON vertex
+static bool CheckTransformKernel(void)
 {
-    unsigned int program = 0;
+    BatchVertex simd[11] = { 0 };
+    BatchVertex scalar[11] = { 0 };
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-
-    GLint success = 0;
-    program = glCreateProgram();
+    Matrix mat = MatrixMultiply(MatrixMultiply(MatrixTranslate(-3.1f, 7.7f, 0.3f), MatrixRotate(Vector3Normalize((Vector3){ 0.3f, -1.0f, 0.7f }), 0.7f)), MatrixScale(1.3f, 0.9f, 2.1f));
 
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
-
-    // NOTE: Default attribute shader locations must be binded before linking
-    glBindAttribLocation(program, 0, DEFAULT_ATTRIB_POSITION_NAME);
-    glBindAttribLocation(program, 1, DEFAULT_ATTRIB_TEXCOORD_NAME);
-    glBindAttribLocation(program, 2, DEFAULT_ATTRIB_NORMAL_NAME);
-    glBindAttribLocation(program, 3, DEFAULT_ATTRIB_COLOR_NAME);
-    glBindAttribLocation(program, 4, DEFAULT_ATTRIB_TANGENT_NAME);
-    glBindAttribLocation(program, 5, DEFAULT_ATTRIB_TEXCOORD2_NAME);
+    for (int i = 0; i < 11; i++)
+    {
+        simd[i].x = scalar[i].x = 0.37f*i - 11.1f;
+        simd[i].y = scalar[i].y = 101.3f - 3.9f*i*i;
+        simd[i].z = scalar[i].z = 0.001f*i;
+    }
 
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    TransformVertices(simd, 11, mat, true);
+    TransformVertices(scalar, 11, mat, false);
 
-    glLinkProgram(program);
+    bool exact = (memcmp(simd, scalar, sizeof(simd)) == 0);
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+    if (!exact) TraceLog(LOG_WARNING, "SIMD vertex transform not bit-exact, using scalar path");
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    return exact;
+}
 
-    if (success == GL_FALSE)
+// Reset draw calls from start index, using current draw state (shader, blending, scissor)
+static void ResetDrawCalls(int start)
+{
+    for (int i = start; i < batchDrawCalls; i++)
     {
-        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to link shader program...", program);
+        draws[i].mode = RL_QUADS;
+        draws[i].vertexCount = 0;
+        draws[i].vertexAlignment = 0;
+        draws[i].textures[0] = defaultTextureId;
+        draws[i].texturesCount = 1;
+        draws[i].shader = currentShader;
+        draws[i].blendMode = blendMode;
+        draws[i].scissorEnabled = scissorEnabled;
+        for (int k = 0; k < 4; k++) draws[i].scissorRec[k] = scissorRec[k];
+        draws[i].layer = currentLayer;
+        draws[i].opaque = false;
+    }
+}
 
-        int maxLength = 0;
-        int length;
+// Grow default internal buffers (CPU arrays and GPU buffers) to fit some additional vertex
+// NOTE: Capacity is doubled until it fits, current batch vertex data is kept
+static bool GrowBuffersDefault(int vCount)
+{
+    int elements = batchElements;
+    int required = vertexData[currentBuffer].vCounter + vCount;
 
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+    while ((elements*4) <= required) elements *= 2;
 
-#if defined(_MSC_VER)
-        char *log = RL_MALLOC(maxLength);
-#else
-        char log[maxLength];
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Indices are 16bit on OpenGL ES 2.0, it limits vertex count to 65536
+    if (elements > 16384) elements = 16384;
+    if ((elements*4) <= required) return false;
 #endif
-        glGetProgramInfoLog(program, maxLength, &length, log);
 
-        TraceLog(LOG_INFO, "%s", log);
+    // Keep current batch vertex data, buffers are reloaded
+    int vCounter = vertexData[currentBuffer].vCounter;
+    BatchVertex *vertices = (BatchVertex *)RL_MALLOC(sizeof(BatchVertex)*vCounter);
+    memcpy(vertices, vertexData[currentBuffer].vertices, sizeof(BatchVertex)*vCounter);
 
-#if defined(_MSC_VER)
-        RL_FREE(log);
-#endif
-        glDeleteProgram(program);
+    UnloadBuffersDefault();
+    batchElements = elements;
+    LoadBuffersDefault();
 
-        program = 0;
-    }
-    else TraceLog(LOG_INFO, "[SHDR ID %i] Shader program loaded successfully", program);
-#endif
-    return program;
-}
+    memcpy(vertexData[currentBuffer].vertices, vertices, sizeof(BatchVertex)*vCounter);
+    vertexData[currentBuffer].vCounter = vCounter;
+    RL_FREE(vertices);
 
+    TraceLog(LOG_INFO, "Batch buffers grown to %i elements", batchElements);
 
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-static Shader LoadShaderDefault(void)
-{
-    Shader shader = { 0 };
-    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+    return true;
+}
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+// Merge compatible draw calls (same mode, texture, shader, blending and scissor) and reorder vertex data
+// NOTE: A draw call can only be moved back to join a previous compatible group of draws if its
+// screen-space bounds do not overlap any of the groups it jumps over, that way painter's order is preserved
+static void MergeDrawCalls(void)
+{
+    int count = drawsCounter;
+    Matrix matMVP = MatrixMultiply(modelview, projection);
 
-    // Vertex shader directly defined, no external file required
-    const char *defaultVShaderStr =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330                       \n"
-    "in vec3 vertexPosition;            \n"
-    "in vec2 vertexTexCoord;            \n"
-    "in vec4 vertexColor;               \n"
-    "out vec2 fragTexCoord;             \n"
-    "out vec4 fragColor;                \n"
-#endif
-    "uniform mat4 mvp;                  \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    fragTexCoord = vertexTexCoord; \n"
-    "    fragColor = vertexColor;       \n"
-    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-    "}                                  \n";
+    CheckDrawsScratch();
 
-    // Fragment shader directly defined, no external file required
-    const char *defaultFShaderStr =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330       \n"
-    "in vec2 fragTexCoord;              \n"
-    "in vec4 fragColor;                 \n"
-    "out vec4 finalColor;               \n"
-#endif
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n" // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
-    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
-#endif
-    "}                                  \n";
+    // Work arrays: per draw vertex offset, count and next draw in group, per group first and last draw
+    // Bounds arrays: per draw and per group screen-space bounds (xmin, ymin, xmax, ymax)
+    int *work = drawsWork;
+    float *bounds = drawsBounds;
 
-    // NOTE: Compiled vertex/fragment shaders are kept for re-use
-    defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
-    defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    int *offsets = work;
+    int *counts = work + count;
+    int *next = work + 2*count;
+    int *groupFirst = work + 3*count;
+    int *groupLast = work + 4*count;
+    float *groupBounds = bounds + 4*count;
 
-    shader.id = LoadShaderProgram(defaultVShaderId, defaultFShaderId);
+    // Compute draws screen-space bounds (normalized device coordinates)
+    int offset = 0;
 
-    if (shader.id > 0)
+    for (int i = 0; i < count; i++)
     {
-        TraceLog(LOG_INFO, "[SHDR ID %i] Default shader loaded successfully", shader.id);
+        float *b = &bounds[4*i];
 
-        // Set default shader locations: attributes locations
-        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
-        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
-        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+        offsets[i] = offset;
+        counts[i] = draws[i].vertexCount;
+        next[i] = -1;
 
-        // Set default shader locations: uniform locations
-        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
-        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
-        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+        b[0] = FLT_MAX; b[1] = FLT_MAX; b[2] = -FLT_MAX; b[3] = -FLT_MAX;
 
-        // NOTE: We could also use below function but in case DEFAULT_ATTRIB_* points are
-        // changed for external custom shaders, we just use direct bindings above
-        //SetShaderDefaultLocations(&shader);
+        for (int v = offset; v < (offset + counts[i]); v++)
+        {
+            BatchVertex *vertex = &vertexData[currentBuffer].vertices[v];
+
+            float x = matMVP.m0*vertex->x + matMVP.m4*vertex->y + matMVP.m8*vertex->z + matMVP.m12;
+            float y = matMVP.m1*vertex->x + matMVP.m5*vertex->y + matMVP.m9*vertex->z + matMVP.m13;
+            float w = matMVP.m3*vertex->x + matMVP.m7*vertex->y + matMVP.m11*vertex->z + matMVP.m15;
+
+            // Vertex behind the viewer, bounds can not be trusted: consider it covering all screen
+            if (w <= 0.0f)
+            {
+                b[0] = -FLT_MAX; b[1] = -FLT_MAX; b[2] = FLT_MAX; b[3] = FLT_MAX;
+                break;
+            }
+
+            x /= w;
+            y /= w;
+
+            if (x < b[0]) b[0] = x;
+            if (y < b[1]) b[1] = y;
+            if (x > b[2]) b[2] = x;
+            if (y > b[3]) b[3] = y;
+        }
+
+        offset += (draws[i].vertexCount + draws[i].vertexAlignment);
     }
-    else TraceLog(LOG_WARNING, "[SHDR ID %i] Default shader could not be loaded", shader.id);
 
-    return shader;
-}
+    // Group draws, every draw joins the nearest previous compatible group it can be moved to
+    int groups = 0;
 
-// Get location handlers to for shader attributes and uniforms
-// NOTE: If any location is not found, loc point becomes -1
-static void SetShaderDefaultLocations(Shader *shader)
-{
-    // NOTE: Default shader attrib locations have been fixed before linking:
-    //          vertex position location    = 0
-    //          vertex texcoord location    = 1
-    //          vertex normal location      = 2
-    //          vertex color location       = 3
-    //          vertex tangent location     = 4
-    //          vertex texcoord2 location   = 5
+    for (int i = 0; i < count; i++)
+    {
+        if (counts[i] == 0) continue;
 
-    // Get handles to GLSL input attibute locations
-    shader->locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_POSITION_NAME);
-    shader->locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD_NAME);
-    shader->locs[LOC_VERTEX_TEXCOORD02] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD2_NAME);
-    shader->locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_NORMAL_NAME);
-    shader->locs[LOC_VERTEX_TANGENT] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TANGENT_NAME);
-    shader->locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_COLOR_NAME);
+        float *b = &bounds[4*i];
+        int target = -1;
 
-    // Get handles to GLSL uniform locations (vertex shader)
-    shader->locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader->id, "mvp");
-    shader->locs[LOC_MATRIX_PROJECTION]  = glGetUniformLocation(shader->id, "projection");
-    shader->locs[LOC_MATRIX_VIEW]  = glGetUniformLocation(shader->id, "view");
+        for (int g = groups - 1; (g >= 0) && (g >= (groups - MAX_DEFERRED_MERGE_LOOKBACK)); g--)
+        {
+            DrawCall *first = &draws[groupFirst[g]];
+
+            if ((first->mode == draws[i].mode) && (first->texturesCount == draws[i].texturesCount) &&
+                (memcmp(first->textures, draws[i].textures, sizeof(unsigned int)*first->texturesCount) == 0) &&
+                (first->shader.id == draws[i].shader.id) && (first->blendMode == draws[i].blendMode) &&
+                (first->layer == draws[i].layer) && (first->scissorEnabled == draws[i].scissorEnabled) &&
+                (!first->scissorEnabled || ((first->scissorRec[0] == draws[i].scissorRec[0]) && (first->scissorRec[1] == draws[i].scissorRec[1]) &&
+                                            (first->scissorRec[2] == draws[i].scissorRec[2]) && (first->scissorRec[3] == draws[i].scissorRec[3]))))
+            {
+                target = g;
+                break;
+            }
 
-    // Get handles to GLSL uniform locations (fragment shader)
-    shader->locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader->id, "colDiffuse");
-    shader->locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader->id, "texture0");
-    shader->locs[LOC_MAP_SPECULAR] = glGetUniformLocation(shader->id, "texture1");
-    shader->locs[LOC_MAP_NORMAL] = glGetUniformLocation(shader->id, "texture2");
-}
+            // Draw can not be moved over an overlapping group
+            float *gb = &groupBounds[4*g];
+            if ((b[0] < gb[2]) && (b[2] > gb[0]) && (b[1] < gb[3]) && (b[3] > gb[1])) break;
+        }
 
-// Unload default shader
-static void UnloadShaderDefault(void)
-{
-    glUseProgram(0);
+        if (target == -1)
+        {
+            target = groups;
+            groupFirst[target] = i;
+            groupLast[target] = i;
+            for (int k = 0; k < 4; k++) groupBounds[4*target + k] = b[k];
+            groups++;
+        }
+        else
+        {
+            float *gb = &groupBounds[4*target];
 
-    glDetachShader(defaultShader.id, defaultVShaderId);
-    glDetachShader(defaultShader.id, defaultFShaderId);
-    glDeleteShader(defaultVShaderId);
-    glDeleteShader(defaultFShaderId);
+            next[groupLast[target]] = i;
+            groupLast[target] = i;
 
-    glDeleteProgram(defaultShader.id);
-}
+            if (b[0] < gb[0]) gb[0] = b[0];
+            if (b[1] < gb[1]) gb[1] = b[1];
+            if (b[2] > gb[2]) gb[2] = b[2];
+            if (b[3] > gb[3]) gb[3] = b[3];
+        }
+    }
 
-// Load default internal buffers
-static void LoadBuffersDefault(void)
-{
-    // Initialize CPU (RAM) arrays (vertex position, texcoord, color data and indexes)
-    //--------------------------------------------------------------------------------------------
-    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+    // Check merged vertex data fits in buffers (alignment could require some extra vertex)
+    int total = 0;
+
+    for (int g = 0; g < groups; g++)
     {
-        vertexData[i].vertices = (float *)RL_MALLOC(sizeof(float)*3*4*MAX_BATCH_ELEMENTS);        // 3 float by vertex, 4 vertex by quad
-        vertexData[i].texcoords = (float *)RL_MALLOC(sizeof(float)*2*4*MAX_BATCH_ELEMENTS);       // 2 float by texcoord, 4 texcoord by quad
-        vertexData[i].colors = (unsigned char *)RL_MALLOC(sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS);  // 4 float by color, 4 colors by quad
-#if defined(GRAPHICS_API_OPENGL_33)
-        vertexData[i].indices = (unsigned int *)RL_MALLOC(sizeof(unsigned int)*6*MAX_BATCH_ELEMENTS);      // 6 int by quad (indices)
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        vertexData[i].indices = (unsigned short *)RL_MALLOC(sizeof(unsigned short)*6*MAX_BATCH_ELEMENTS);  // 6 int by quad (indices)
-#endif
+        int groupCount = 0;
+        for (int j = groupFirst[g]; j != -1; j = next[j]) groupCount += counts[j];
 
-        for (int j = 0; j < (3*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].colors[j] = 0;
+        total += groupCount;
+        if (g < (groups - 1)) total += ((4 - groupCount%4)%4);
+    }
 
-        int k = 0;
+    if ((groups < count) && (total <= (4*batchElements)))
+    {
+        // Copy vertex data in groups order and register merged draw calls
+        // NOTE: Group first draw index is always >= group index, so draws can be overwritten in order
+        BatchVertex *vertices = vertexData[currentBuffer].vertices;
+        int vCounter = 0;
 
-        // Indices can be initialized right now
-        for (int j = 0; j < (6*MAX_BATCH_ELEMENTS); j += 6)
+        for (int g = 0; g < groups; g++)
         {
-            vertexData[i].indices[j] = 4*k;
-            vertexData[i].indices[j + 1] = 4*k + 1;
-            vertexData[i].indices[j + 2] = 4*k + 2;
-            vertexData[i].indices[j + 3] = 4*k;
-            vertexData[i].indices[j + 4] = 4*k + 2;
-            vertexData[i].indices[j + 5] = 4*k + 3;
+            DrawCall draw = draws[groupFirst[g]];
+            int start = vCounter;
+
+            for (int j = groupFirst[g]; j != -1; j = next[j])
+            {
+                memcpy(&mergeVertices[vCounter], &vertices[offsets[j]], sizeof(BatchVertex)*counts[j]);
+                vCounter += counts[j];
+            }
 
-            k++;
+            draw.vertexCount = vCounter - start;
+            draw.vertexAlignment = (g < (groups - 1))? ((4 - draw.vertexCount%4)%4) : 0;
+            vCounter += draw.vertexAlignment;
+
+            draws[g] = draw;
         }
 
-        vertexData[i].vCounter = 0;
-        vertexData[i].tcCounter = 0;
-        vertexData[i].cCounter = 0;
+        for (int i = groups; i < count; i++)
+        {
+            draws[i].vertexCount = 0;
+            draws[i].vertexAlignment = 0;
+        }
+
+        // Swap vertex arrays, previous one is reused on next merge
+        vertexData[currentBuffer].vertices = mergeVertices;
+        vertexData[currentBuffer].vCounter = vCounter;
+        mergeVertices = vertices;
+        drawsCounter = (groups > 0)? groups : 1;
     }
+}
 
-    TraceLog(LOG_INFO, "Internal buffers initialized successfully (CPU)");
-    //--------------------------------------------------------------------------------------------
+// Check draw calls scratch arrays fit batch draw calls limit, arrays are only reallocated when limit grows
+static void CheckDrawsScratch(void)
+{
+    if (drawsScratchCapacity >= batchDrawCalls) return;
 
-    // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
-    //--------------------------------------------------------------------------------------------
-    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+    drawsScratchCapacity = batchDrawCalls;
+    drawsWork = (int *)RL_REALLOC(drawsWork, sizeof(int)*5*drawsScratchCapacity);
+    drawsBounds = (float *)RL_REALLOC(drawsBounds, sizeof(float)*8*drawsScratchCapacity);
+    drawsSorted = (DrawCall *)RL_REALLOC(drawsSorted, sizeof(DrawCall)*drawsScratchCapacity);
+}
+
+// Check quad is fully outside current scissor rectangle, using its screen-space bounds
+// NOTE: Vertex are transformed by transform matrix (if used), modelview and projection, quads
+// with any vertex behind the viewer are never culled
+static bool CheckQuadScissorCulled(const BatchVertex *vertices)
+{
+    if ((scissorRec[2] <= 0) || (scissorRec[3] <= 0)) return true;
+
+    UpdateCullMatrix();
+
+    float xmin = FLT_MAX, ymin = FLT_MAX, xmax = -FLT_MAX, ymax = -FLT_MAX;
+
+    for (int i = 0; i < 4; i++)
     {
-        if (vaoSupported)
-        {
-            // Initialize Quads VAO
-            glGenVertexArrays(1, &vertexData[i].vaoId);
-            glBindVertexArray(vertexData[i].vaoId);
-        }
+        float x = cullMatrix.m0*vertices[i].x + cullMatrix.m4*vertices[i].y + cullMatrix.m8*vertices[i].z + cullMatrix.m12;
+        float y = cullMatrix.m1*vertices[i].x + cullMatrix.m5*vertices[i].y + cullMatrix.m9*vertices[i].z + cullMatrix.m13;
+        float w = cullMatrix.m3*vertices[i].x + cullMatrix.m7*vertices[i].y + cullMatrix.m11*vertices[i].z + cullMatrix.m15;
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &vertexData[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, vertexData[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        if (w <= 0.0f) return false;
 
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &vertexData[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, vertexData[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &vertexData[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS, vertexData[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        // Normalized device coordinates to window coordinates (bottom-left origin, same as scissor)
+        x = currentViewport[0] + (x/w*0.5f + 0.5f)*currentViewport[2];
+        y = currentViewport[1] + (y/w*0.5f + 0.5f)*currentViewport[3];
 
-        // Fill index buffer
-        glGenBuffers(1, &vertexData[i].vboId[3]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexData[i].vboId[3]);
-#if defined(GRAPHICS_API_OPENGL_33)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int)*6*MAX_BATCH_ELEMENTS, vertexData[i].indices, GL_STATIC_DRAW);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(short)*6*MAX_BATCH_ELEMENTS, vertexData[i].indices, GL_STATIC_DRAW);
-#endif
+        if (x < xmin) xmin = x;
+        if (y < ymin) ymin = y;
+        if (x > xmax) xmax = x;
+        if (y > ymax) ymax = y;
     }
 
-    TraceLog(LOG_INFO, "Internal buffers uploaded successfully (GPU)");
-
-    // Unbind the current VAO
-    if (vaoSupported) glBindVertexArray(0);
-    //--------------------------------------------------------------------------------------------
+    return ((xmax <= scissorRec[0]) || (xmin >= (scissorRec[0] + scissorRec[2])) ||
+            (ymax <= scissorRec[1]) || (ymin >= (scissorRec[1] + scissorRec[3])));
 }
 
-// Update default internal buffers (VAOs/VBOs) with vertex array data
-// NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
-// TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
-static void UpdateBuffersDefault(void)
+// Update culling transform (transform matrix, modelview and projection) and visible area bounds, only if matrices changed
+// NOTE: Visible area bounds are normalized device coordinates square transformed back to current transform space,
+// they are only computed for 2D affine transforms (no perspective, Z not mixed into X/Y)
+static void UpdateCullMatrix(void)
 {
-    // Update vertex buffers data
-    if (vertexData[currentBuffer].vCounter > 0)
+    if (cullValid && (cullVersion == transformVersion) && (cullTransform == useTransformMatrix)) return;
+
+    cullMatrix = MatrixMultiply(modelview, projection);
+    if (useTransformMatrix) cullMatrix = MatrixMultiply(transformMatrix, cullMatrix);
+
+    cullVersion = transformVersion;
+    cullTransform = useTransformMatrix;
+    cullValid = true;
+
+    Matrix m = cullMatrix;
+    float det = m.m0*m.m5 - m.m4*m.m1;
+
+    viewBoundsValid = (m.m3 == 0.0f) && (m.m7 == 0.0f) && (m.m11 == 0.0f) && (m.m15 == 1.0f) &&
+                      (m.m8 == 0.0f) && (m.m9 == 0.0f) && (det != 0.0f);
+
+    if (viewBoundsValid)
     {
-        // Activate elements VAO
-        if (vaoSupported) glBindVertexArray(vertexData[currentBuffer].vaoId);
-
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*3*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*2*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(unsigned char)*4*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // vertexData[currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (vertexData[currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
+        viewBounds[0] = FLT_MAX; viewBounds[1] = FLT_MAX; viewBounds[2] = -FLT_MAX; viewBounds[3] = -FLT_MAX;
 
-        // Unbind the current VAO
-        if (vaoSupported) glBindVertexArray(0);
+        for (int i = 0; i < 4; i++)
+        {
+            float nx = ((i%2) == 0)? (-1.0f - m.m12) : (1.0f - m.m12);
+            float ny = ((i/2) == 0)? (-1.0f - m.m13) : (1.0f - m.m13);
+            float x = (m.m5*nx - m.m4*ny)/det;
+            float y = (m.m0*ny - m.m1*nx)/det;
+
+            if (x < viewBounds[0]) viewBounds[0] = x;
+            if (y < viewBounds[1]) viewBounds[1] = y;
+            if (x > viewBounds[2]) viewBounds[2] = x;
+            if (y > viewBounds[3]) viewBounds[3] = y;
+        }
     }
 }
 
-// Draw default internal buffers vertex data
-static void DrawBuffersDefault(void)
+// Sort draw calls by layer and reorder vertex data, painter's order is kept inside a layer
+// NOTE: On depth sort, opaque draws go first from the nearest layer (hidden fragments rejected by depth test),
+// translucent draws follow from the farthest layer; draws are counting sorted (stable) by layer key
+static void SortDrawCalls(bool depthSort)
 {
-    Matrix matProjection = projection;
-    Matrix matModelView = modelview;
+    int count = drawsCounter;
+    bool layered = false;
 
-    int eyesCount = 1;
+    for (int i = 1; i < count; i++) if (draws[i].layer != draws[0].layer) { layered = true; break; }
 
-    for (int eye = 0; eye < eyesCount; eye++)
-    {
+    if (!layered && !depthSort) return;
 
-        // Draw buffers
-        if (vertexData[currentBuffer].vCounter > 0)
-        {
-            // Set current shader and upload current MVP matrix
-            glUseProgram(currentShader.id);
+    CheckDrawsScratch();
 
-            // Create modelview-projection matrix
-            Matrix matMVP = MatrixMultiply(modelview, projection);
+    // Work arrays: per draw vertex offset, sort key and sorted draws order
+    int *work = drawsWork;
+    int *offsets = work;
+    int *keys = work + count;
+    int *order = work + 2*count;
+    int buckets[2*MAX_BATCH_LAYERS + 1] = { 0 };
+
+    int offset = 0;
 
-            glUniformMatrix4fv(currentShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
-            glUniform4f(currentShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(currentShader.locs[LOC_MAP_DIFFUSE], 0);    // Provided value refers to the texture unit (active)
+    for (int i = 0; i < count; i++)
+    {
+        offsets[i] = offset;
+        draws[i].opaque = depthSort && (draws[i].vertexCount > 0) && CheckDrawOpaque(&draws[i], &vertexData[currentBuffer].vertices[offset]);
 
-            // TODO: Support additional texture units on custom shader
-            //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) glUniform1i(currentShader.locs[LOC_MAP_SPECULAR], 1);
-            //if (currentShader->locs[LOC_MAP_NORMAL] > 0) glUniform1i(currentShader.locs[LOC_MAP_NORMAL], 2);
+        if (!depthSort) keys[i] = draws[i].layer;
+        else if (draws[i].opaque) keys[i] = MAX_BATCH_LAYERS - 1 - draws[i].layer;
+        else keys[i] = MAX_BATCH_LAYERS + draws[i].layer;
 
-            // NOTE: Right now additional map textures not considered for default buffers drawing
+        buckets[keys[i] + 1]++;
+        offset += (draws[i].vertexCount + draws[i].vertexAlignment);
+    }
 
-            int vertexOffset = 0;
+    // Buckets start positions, draws keep registration order inside every bucket
+    for (int k = 1; k <= 2*MAX_BATCH_LAYERS; k++) buckets[k] += buckets[k - 1];
 
-            if (vaoSupported) glBindVertexArray(vertexData[currentBuffer].vaoId);
-            else
-            {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
-                glVertexAttribPointer(currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_POSITION]);
+    bool sorted = true;
 
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[1]);
-                glVertexAttribPointer(currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_TEXCOORD01]);
+    for (int i = 0; i < count; i++)
+    {
+        int position = buckets[keys[i]]++;
+        order[position] = i;
+        if (position != i) sorted = false;
+    }
 
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[2]);
-                glVertexAttribPointer(currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_COLOR]);
+    // Check sorted vertex data fits in buffers (alignment could require some extra vertex)
+    int total = 0;
+    for (int i = 0; i < count; i++) total += (draws[i].vertexCount + ((4 - draws[i].vertexCount%4)%4));
 
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexData[currentBuffer].vboId[3]);
-            }
+    if (!sorted && (total <= (4*batchElements)))
+    {
+        if (mergeVertices == NULL) mergeVertices = (BatchVertex *)RL_CALLOC(4*batchElements, sizeof(BatchVertex));
 
-            glActiveTexture(GL_TEXTURE0);
+        // Copy vertex data in sorted order, empty draws are dropped
+        BatchVertex *vertices = vertexData[currentBuffer].vertices;
+        DrawCall *sortedDraws = drawsSorted;
+        int sortedCount = 0;
+        int vCounter = 0;
 
-            for (int i = 0; i < drawsCounter; i++)
-            {
-                glBindTexture(GL_TEXTURE_2D, draws[i].textureId);
+        for (int i = 0; i < count; i++)
+        {
+            DrawCall draw = draws[order[i]];
 
-                // TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
-                //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
-                //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
+            if (draw.vertexCount == 0) continue;
 
-                if ((draws[i].mode == RL_LINES) || (draws[i].mode == RL_TRIANGLES)) glDrawArrays(draws[i].mode, vertexOffset, draws[i].vertexCount);
-                else
-                {
-#if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: quadsCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6));
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(sizeof(GLushort)*vertexOffset/4*6));
-#endif
-                }
+            memcpy(&mergeVertices[vCounter], &vertices[offsets[order[i]]], sizeof(BatchVertex)*draw.vertexCount);
 
-                vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
-            }
+            draw.vertexAlignment = (4 - draw.vertexCount%4)%4;
+            vCounter += (draw.vertexCount + draw.vertexAlignment);
 
-            if (!vaoSupported)
-            {
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-            }
+            sortedDraws[sortedCount] = draw;
+            sortedCount++;
+        }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+        if (sortedCount > 0)
+        {
+            vCounter -= sortedDraws[sortedCount - 1].vertexAlignment;
+            sortedDraws[sortedCount - 1].vertexAlignment = 0;
         }
 
-        if (vaoSupported) glBindVertexArray(0); // Unbind VAO
+        memcpy(draws, sortedDraws, sizeof(DrawCall)*sortedCount);
 
-        glUseProgram(0);    // Unbind shader program
+        for (int i = sortedCount; i < count; i++)
+        {
+            draws[i].vertexCount = 0;
+            draws[i].vertexAlignment = 0;
+        }
+
+        // Swap vertex arrays, previous one is reused on next sort
+        vertexData[currentBuffer].vertices = mergeVertices;
+        vertexData[currentBuffer].vCounter = vCounter;
+        mergeVertices = vertices;
+        drawsCounter = (sortedCount > 0)? sortedCount : 1;
     }
+    else if (!sorted) TraceLog(LOG_WARNING, "Batch draw calls could not be sorted by layer, no space for vertex alignment");
+}
 
-    // Reset vertex counters for next frame
-    vertexData[currentBuffer].vCounter = 0;
-    vertexData[currentBuffer].tcCounter = 0;
-    vertexData[currentBuffer].cCounter = 0;
+// Check draw call is opaque: alpha blending with default shader, opaque textures and opaque vertex colors
+// NOTE: Custom shaders could output any alpha, their draws are always considered translucent
+static bool CheckDrawOpaque(const DrawCall *draw, const BatchVertex *vertices)
+{
+    if ((draw->blendMode != BLEND_ALPHA) || (draw->shader.id != defaultShader.id)) return false;
 
-    // Reset depth for next draw
-    currentDepth = -1.0f;
+    for (int i = 0; i < draw->texturesCount; i++) if (!IsTextureOpaque(draw->textures[i])) return false;
 
-    // Restore projection/modelview matrices
-    projection = matProjection;
-    modelview = matModelView;
+    for (int i = 0; i < draw->vertexCount; i++) if (vertices[i].a < 255) return false;
+
+    return true;
+}
+
+// Get depth for new primitives
+// NOTE: On depth sort mode depth is given by current layer depth range and primitives already drawn on that layer,
+// otherwise it is reset after a batch draw and incremented on every primitive
+static float GetBaseDepth(void)
+{
+    if (!depthSortMode) return -1.0f;
+
+    return -1.0f + (float)(currentLayer*MAX_LAYER_DEPTH_STEPS + layerDepthSteps[currentLayer])/(float)(MAX_BATCH_LAYERS*MAX_LAYER_DEPTH_STEPS);
+}
 
-    // Reset draws array
-    for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
+// Advance depth for next primitive, following primitives are drawn on top
+// NOTE: On depth sort mode depth never leaves current layer depth range, once range steps are exhausted
+// following primitives of that layer share depth (translucent draws could be drawn over following opaque draws)
+static void NextPrimitiveDepth(void)
+{
+    if (depthSortMode)
     {
-        draws[i].mode = RL_QUADS;
-        draws[i].vertexCount = 0;
-        draws[i].textureId = defaultTextureId;
+        if (layerDepthSteps[currentLayer] < (MAX_LAYER_DEPTH_STEPS - 1)) layerDepthSteps[currentLayer]++;
+        currentDepth = GetBaseDepth();
     }
+    else currentDepth += (1.0f/20000.0f);
+}
 
-    drawsCounter = 1;
+// Check pixel data is opaque, formats without alpha channel are always opaque
+// NOTE: Compressed formats with alpha and NULL data with alpha channel are considered translucent
+static bool CheckPixelsOpaque(const void *data, int width, int height, int format)
+{
+    bool opaque = false;
+    int count = width*height;
 
-    // Change to next buffer in the list
-    currentBuffer++;
-    if (currentBuffer >= MAX_BATCH_BUFFERING) currentBuffer = 0;
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE:
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R8G8B8:
+        case UNCOMPRESSED_R32:
+        case UNCOMPRESSED_R32G32B32:
+        case COMPRESSED_DXT1_RGB:
+        case COMPRESSED_ETC1_RGB:
+        case COMPRESSED_ETC2_RGB:
+        case COMPRESSED_PVRT_RGB: opaque = true; break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            const unsigned char *pixels = (const unsigned char *)data;
+            opaque = (pixels != NULL);
+            for (int i = 0; opaque && (i < count); i++) if (pixels[2*i + 1] < 255) opaque = false;
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            const unsigned short *pixels = (const unsigned short *)data;
+            opaque = (pixels != NULL);
+            for (int i = 0; opaque && (i < count); i++) if ((pixels[i] & 0x1) == 0) opaque = false;
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            const unsigned short *pixels = (const unsigned short *)data;
+            opaque = (pixels != NULL);
+            for (int i = 0; opaque && (i < count); i++) if ((pixels[i] & 0xf) != 0xf) opaque = false;
+        } break;
+        case UNCOMPRESSED_R8G8B8A8:
+        {
+            const unsigned char *pixels = (const unsigned char *)data;
+            opaque = (pixels != NULL);
+            for (int i = 0; opaque && (i < count); i++) if (pixels[4*i + 3] < 255) opaque = false;
+        } break;
+        case UNCOMPRESSED_R32G32B32A32:
+        {
+            const float *pixels = (const float *)data;
+            opaque = (pixels != NULL);
+            for (int i = 0; opaque && (i < count); i++) if (pixels[4*i + 3] < 1.0f) opaque = false;
+        } break;
+        default: break;
+    }
+
+    return opaque;
+}
+
+// Check texture is registered as opaque
+static bool IsTextureOpaque(unsigned int id)
+{
+    return (id < textureOpaqueCapacity) && (textureOpaque[id] != 0);
+}
+
+// Register texture opaque flag (array grown as required, indexed by texture id)
+static void SetTextureOpaque(unsigned int id, bool opaque)
+{
+    if (id >= textureOpaqueCapacity)
+    {
+        if (!opaque) return;
+
+        unsigned int capacity = (textureOpaqueCapacity > 0)? textureOpaqueCapacity : 64;
+        while (capacity <= id) capacity *= 2;
+
+        textureOpaque = (unsigned char *)RL_REALLOC(textureOpaque, capacity);
+        memset(textureOpaque + textureOpaqueCapacity, 0, capacity - textureOpaqueCapacity);
+        textureOpaqueCapacity = capacity;
+    }
+
+    textureOpaque[id] = opaque? 1 : 0;
 }
 
 // Unload default internal buffers vertex data from CPU and GPU
 static void UnloadBuffersDefault(void)
 {
     // Unbind everything
-    if (vaoSupported) glBindVertexArray(0);
+    if (vaoSupported) SetStateVertexArray(0);
     glDisableVertexAttribArray(0);
     glDisableVertexAttribArray(1);
     glDisableVertexAttribArray(2);
     glDisableVertexAttribArray(3);
+    if (defaultTexSlotLoc != -1) glDisableVertexAttribArray(defaultTexSlotLoc);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
     for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
     {
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+        // Release persistent mapping and pending fence
+        if (vertexData[i].fence != NULL) glDeleteSync((GLsync)vertexData[i].fence);
+        if (vertexData[i].mappedVertices != NULL)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[0]);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+
+        vertexData[i].fence = NULL;
+        vertexData[i].mappedVertices = NULL;
+#endif
         // Delete VBOs from GPU (VRAM)
         glDeleteBuffers(1, &vertexData[i].vboId[0]);
         glDeleteBuffers(1, &vertexData[i].vboId[1]);
-        glDeleteBuffers(1, &vertexData[i].vboId[2]);
-        glDeleteBuffers(1, &vertexData[i].vboId[3]);
 
         // Delete VAOs from GPU (VRAM)
         if (vaoSupported) glDeleteVertexArrays(1, &vertexData[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
         RL_FREE(vertexData[i].vertices);
-        RL_FREE(vertexData[i].texcoords);
-        RL_FREE(vertexData[i].colors);
         RL_FREE(vertexData[i].indices);
     }
+
+    RL_FREE(mergeVertices);
+    mergeVertices = NULL;
+}
+
+#if defined(GRAPHICS_API_NONE)
+// Record current batch vertex data and draw calls as a flush command
+static void RecordBatchFlush(Matrix mvp)
+{
+    rlRecordCommand *command = RecordCommand(RL_RECORD_FLUSH, 0);
+
+    command->mvp = mvp;
+    command->vertexCount = vertexData[currentBuffer].vCounter;
+#if !defined(GRAPHICS_API_SOFTWARE)
+    command->vertices = (rlQuadVertex *)RL_MALLOC(sizeof(rlQuadVertex)*command->vertexCount);
+    memcpy(command->vertices, vertexData[currentBuffer].vertices, sizeof(rlQuadVertex)*command->vertexCount);
+#endif
+
+    command->draws = (rlRecordDraw *)RL_MALLOC(sizeof(rlRecordDraw)*drawsCounter);
+
+    int vertexOffset = 0;
+
+    for (int i = 0; i < drawsCounter; i++)
+    {
+        // NOTE: Empty draws (state changes) are not recorded
+        if (draws[i].vertexCount > 0)
+        {
+            rlRecordDraw *draw = &command->draws[command->drawsCount];
+
+            draw->mode = draws[i].mode;
+            draw->vertexOffset = vertexOffset;
+            draw->vertexCount = draws[i].vertexCount;
+            for (int k = 0; k < draws[i].texturesCount; k++) draw->textures[k] = draws[i].textures[k];
+            draw->texturesCount = draws[i].texturesCount;
+            draw->shaderId = draws[i].shader.id;
+            draw->blendMode = draws[i].blendMode;
+            draw->scissorEnabled = draws[i].scissorEnabled;
+            for (int k = 0; k < 4; k++) draw->scissorRec[k] = draws[i].scissorRec[k];
+
+            command->drawsCount++;
+        }
+
+        vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+    }
+
+#if defined(GRAPHICS_API_SOFTWARE)
+    // Software backend: batch rasterized, command not kept
+    SwRasterizeBatch(vertexData[currentBuffer].vertices, command->draws, command->drawsCount, mvp);
+    RL_FREE(command->draws);
+#endif
+}
+#endif
+
+// Load sprite instancing shader and buffers
+// NOTE: Instancing shader reuses default fragment shader, shader locations are used as:
+// LOC_VERTEX_POSITION: quad corner, LOC_VERTEX_TEXCOORD01: sourceRec, LOC_VERTEX_TEXCOORD02: destRec,
+// LOC_VERTEX_NORMAL: origin and rotation, LOC_VERTEX_COLOR: tint
+static void LoadInstancing(void)
+{
+    instanceShader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) instanceShader.locs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    // NOTE: Quad corners computed same way than DrawTexturePro(), negative source width/height flip the region
+    const char *instanceVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec2 vertexCorner;       \n"
+    "attribute vec4 instanceSource;     \n"
+    "attribute vec4 instanceDest;       \n"
+    "attribute vec3 instanceTransform;  \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexCorner;              \n"
+    "in vec4 instanceSource;            \n"
+    "in vec4 instanceDest;              \n"
+    "in vec3 instanceTransform;         \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec2 textureSize;          \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 local = vertexCorner*instanceDest.zw - instanceTransform.xy; \n"
+    "    float angle = radians(instanceTransform.z);                       \n"
+    "    float s = sin(angle);                                             \n"
+    "    float c = cos(angle);                                             \n"
+    "    vec2 position = instanceDest.xy + vec2(local.x*c - local.y*s, local.x*s + local.y*c); \n"
+    "    vec2 start = instanceSource.xy - min(instanceSource.zw, 0.0);     \n"
+    "    fragTexCoord = (start + vertexCorner*instanceSource.zw)/textureSize; \n"
+    "    fragColor = instanceColor;                                        \n"
+    "    gl_Position = mvp*vec4(position, 0.0, 1.0);                       \n"
+    "}                                  \n";
+
+    unsigned int vertexShaderId = CompileShader(instanceVShaderStr, GL_VERTEX_SHADER);
+
+    instanceShader.id = LoadShaderProgram(vertexShaderId, defaultFShaderId);
+
+    glDeleteShader(vertexShaderId);     // NOTE: Shader is deleted when program is deleted
+
+    if (instanceShader.id == 0)
+    {
+        TraceLog(LOG_WARNING, "[SHDR ID %i] Sprite instancing shader could not be loaded", instanceShader.id);
+        return;
+    }
+
+    TraceLog(LOG_INFO, "[SHDR ID %i] Sprite instancing shader loaded successfully", instanceShader.id);
+
+    instanceShader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(instanceShader.id, "vertexCorner");
+    instanceShader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(instanceShader.id, "instanceSource");
+    instanceShader.locs[LOC_VERTEX_TEXCOORD02] = glGetAttribLocation(instanceShader.id, "instanceDest");
+    instanceShader.locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(instanceShader.id, "instanceTransform");
+    instanceShader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(instanceShader.id, "instanceColor");
+    instanceShader.locs[LOC_MATRIX_MVP] = glGetUniformLocation(instanceShader.id, "mvp");
+    instanceShader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(instanceShader.id, "colDiffuse");
+    instanceShader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(instanceShader.id, "texture0");
+    LoadShaderUniforms(instanceShader.id);
+    instanceTextureSizeLoc = glGetUniformLocation(instanceShader.id, "textureSize");
+
+    if (vaoSupported)
+    {
+        glGenVertexArrays(1, &instanceVaoId);
+        SetStateVertexArray(instanceVaoId);
+    }
+
+    // Quad corners buffer (per vertex)
+    float corners[8] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+    instanceVboId[0] = rlLoadAttribBuffer(instanceVaoId, instanceShader.locs[LOC_VERTEX_POSITION], corners, sizeof(corners), false);
+
+    // Instances data buffer (per instance), initial capacity grows as required
+    instanceBufferCapacity = 1024;
+    instanceVboId[1] = rlLoadAttribBuffer(instanceVaoId, instanceShader.locs[LOC_VERTEX_TEXCOORD01], NULL, 48*instanceBufferCapacity, true);
+
+    if (vaoSupported)
+    {
+        // Instances data attributes, interleaved layout (same than SpriteInstance)
+        // NOTE: rlLoadAttribBuffer() unbinds VAO
+        SetStateVertexArray(instanceVaoId);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVboId[1]);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_TEXCOORD01], 4, GL_FLOAT, 0, 48, (void *)0);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_TEXCOORD02], 4, GL_FLOAT, 0, 48, (void *)16);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 48, (void *)32);
+        glVertexAttribPointer(instanceShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 48, (void *)44);
+
+        for (int i = LOC_VERTEX_TEXCOORD01; i <= LOC_VERTEX_COLOR; i++)
+        {
+            if (instanceShader.locs[i] == -1) continue;     // NOTE: LOC_VERTEX_TANGENT not used
+
+            glEnableVertexAttribArray(instanceShader.locs[i]);
+            glVertexAttribDivisor(instanceShader.locs[i], 1);
+        }
+
+        SetStateVertexArray(0);
+    }
+    else
+    {
+        // Attributes are set on every draw, rlLoadAttribBuffer() leaves them enabled
+        glDisableVertexAttribArray(instanceShader.locs[LOC_VERTEX_POSITION]);
+        glDisableVertexAttribArray(instanceShader.locs[LOC_VERTEX_TEXCOORD01]);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Unload sprite instancing shader and buffers
+static void UnloadInstancing(void)
+{
+    glDeleteBuffers(2, instanceVboId);
+    if (vaoSupported) glDeleteVertexArrays(1, &instanceVaoId);
+
+    if (instanceShader.id > 0)
+    {
+        glDetachShader(instanceShader.id, defaultFShaderId);
+        glDeleteProgram(instanceShader.id);
+    }
+
+    UnloadShaderUniforms(instanceShader.id);
+    RL_FREE(instanceShader.locs);
+    instanceShader.id = 0;
+    instanceShader.locs = NULL;
 }
 
 // Renders a 1x1 XY quad in NDC
@@ -4082,7 +9468,7 @@ static void GenDrawQuad(void)
     // Set up plane VAO
     glGenVertexArrays(1, &quadVAO);
     glGenBuffers(1, &quadVBO);
-    glBindVertexArray(quadVAO);
+    SetStateVertexArray(quadVAO);
 
     // Fill buffer
     glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
@@ -4095,9 +9481,9 @@ static void GenDrawQuad(void)
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float)));
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    SetStateVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    SetStateVertexArray(0);
 
     glDeleteBuffers(1, &quadVBO);
     glDeleteVertexArrays(1, &quadVAO);
@@ -4157,7 +9543,7 @@ static void GenDrawCube(void)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Link vertex attributes
-    glBindVertexArray(cubeVAO);
+    SetStateVertexArray(cubeVAO);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0);
     glEnableVertexAttribArray(1);
@@ -4165,12 +9551,12 @@ static void GenDrawCube(void)
     glEnableVertexAttribArray(2);
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float)));
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    SetStateVertexArray(0);
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    SetStateVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    SetStateVertexArray(0);
 
     glDeleteBuffers(1, &cubeVBO);
     glDeleteVertexArrays(1, &cubeVAO);
@@ -4306,6 +9692,55 @@ static Color *GenNextMipmap(Color *srcData, int srcWidth, int srcHeight)
 }
 #endif
 
+// Flip RGBA pixels vertically, setting alpha to 255
+// NOTE: Rows are swapped in pairs (top and bottom rows loaded before storing), so it also works in place (dst == src)
+static void FlipPixelsOpaque(unsigned char *dst, const unsigned char *src, int width, int height)
+{
+    int rowSize = width*4;
+
+    for (int y = 0; y < (height + 1)/2; y++)
+    {
+        const unsigned char *srcTop = src + y*rowSize;
+        const unsigned char *srcBottom = src + (height - 1 - y)*rowSize;
+        unsigned char *dstTop = dst + y*rowSize;
+        unsigned char *dstBottom = dst + (height - 1 - y)*rowSize;
+        int x = 0;
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        __m128i alpha = _mm_set1_epi32((int)0xff000000);
+
+        for (; x + 16 <= rowSize; x += 16)
+        {
+            __m128i top = _mm_loadu_si128((const __m128i *)(srcTop + x));
+            __m128i bottom = _mm_loadu_si128((const __m128i *)(srcBottom + x));
+            _mm_storeu_si128((__m128i *)(dstTop + x), _mm_or_si128(bottom, alpha));
+            _mm_storeu_si128((__m128i *)(dstBottom + x), _mm_or_si128(top, alpha));
+        }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        uint8x16_t alpha = vreinterpretq_u8_u32(vdupq_n_u32(0xff000000));
+
+        for (; x + 16 <= rowSize; x += 16)
+        {
+            uint8x16_t top = vld1q_u8(srcTop + x);
+            uint8x16_t bottom = vld1q_u8(srcBottom + x);
+            vst1q_u8(dstTop + x, vorrq_u8(bottom, alpha));
+            vst1q_u8(dstBottom + x, vorrq_u8(top, alpha));
+        }
+#endif
+        for (; x < rowSize; x += 4)
+        {
+            unsigned char top[4], bottom[4];
+            memcpy(top, srcTop + x, 4);
+            memcpy(bottom, srcBottom + x, 4);
+
+            memcpy(dstTop + x, bottom, 3);
+            dstTop[x + 3] = 255;
+            memcpy(dstBottom + x, top, 3);
+            dstBottom[x + 3] = 255;
+        }
+    }
+}
+
 #if defined(RLGL_STANDALONE)
 // Show trace log messages (LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_DEBUG)
 void TraceLog(int msgType, const char *text, ...)
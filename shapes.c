@@ -40,7 +40,7 @@
 #include "rlgl.h"       // raylib OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
 #include <stdlib.h>     // Required for: abs(), fabs()
-#include <math.h>       // Required for: sinf(), cosf(), sqrtf()
+#include <math.h>       // Required for: sinf(), cosf(), sqrtf(), fabsf(), fmaxf()
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -173,6 +173,9 @@ void DrawCircleSector(Vector2 center, float radius, int startAngle, int endAngle
 {
     if (radius <= 0.0f) radius = 0.1f;  // Avoid div by zero
 
+    // Rejected before any vertex work if fully outside visible area (view culling)
+    if (rlCheckViewCulled(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) return;
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -265,6 +268,8 @@ void DrawCircleSectorLines(Vector2 center, float radius, int startAngle, int end
 {
     if (radius <= 0.0f) radius = 0.1f;  // Avoid div by zero issue
 
+    if (rlCheckViewCulled(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) return;
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -329,6 +334,8 @@ void DrawCircleSectorLines(Vector2 center, float radius, int startAngle, int end
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    if (rlCheckViewCulled(centerX - radius, centerY - radius, centerX + radius, centerY + radius)) return;
+
     if (rlCheckBufferLimit(3*36)) rlglDraw();
 
     rlBegin(RL_TRIANGLES);
@@ -354,6 +361,8 @@ void DrawCircleV(Vector2 center, float radius, Color color)
 // Draw circle outline
 void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 {
+    if (rlCheckViewCulled(centerX - radius, centerY - radius, centerX + radius, centerY + radius)) return;
+
     if (rlCheckBufferLimit(2*36)) rlglDraw();
 
     rlBegin(RL_LINES);
@@ -382,6 +391,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, int startAng
         if (outerRadius <= 0.0f) outerRadius = 0.1f;
     }
 
+    if (rlCheckViewCulled(center.x - outerRadius, center.y - outerRadius, center.x + outerRadius, center.y + outerRadius)) return;
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -478,6 +489,8 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, int sta
         if (outerRadius <= 0.0f) outerRadius = 0.1f;
     }
 
+    if (rlCheckViewCulled(center.x - outerRadius, center.y - outerRadius, center.x + outerRadius, center.y + outerRadius)) return;
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -568,6 +581,21 @@ void DrawRectangleRec(Rectangle rec, Color color)
 // Draw a color-filled rectangle with pro parameters
 void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color)
 {
+    // Rejected if fully outside visible area (view culling), rotated rectangles are bounded by
+    // the circle around rotation pivot (rec.x, rec.y) containing its farthest corner
+    if (rotation == 0.0f)
+    {
+        if (rlCheckViewCulled(rec.x - origin.x, rec.y - origin.y, rec.x - origin.x + rec.width, rec.y - origin.y + rec.height)) return;
+    }
+    else
+    {
+        float dx = fmaxf(fabsf(origin.x), fabsf(rec.width - origin.x));
+        float dy = fmaxf(fabsf(origin.y), fabsf(rec.height - origin.y));
+        float radius = sqrtf(dx*dx + dy*dy);
+
+        if (rlCheckViewCulled(rec.x - radius, rec.y - radius, rec.x + radius, rec.y + radius)) return;
+    }
+
     rlEnableTexture(GetShapesTexture().id);
 
     rlPushMatrix();
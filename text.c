@@ -373,6 +373,7 @@ void UnloadFont(Font font)
 
 // Draw text using Font
 // NOTE: chars spacing is NOT proportional to fontSize
+// NOTE: Characters outside visible area are rejected by DrawTexturePro() if view culling is enabled
 void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
 {
     int length = strlen(text);      // Total length in bytes of the text, scanned by codepoints in loop
@@ -54,6 +54,7 @@
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <string.h>             // Required for: strlen()
 #include <stdio.h>              // Required for: FILE, fopen(), fclose(), fread()
+#include <math.h>               // Required for: sinf(), cosf(), fminf(), fmaxf() [Used only on DrawTexturePro()]
 
 #include "utils.h"              // Required for: fopen() Android mapping
 
@@ -609,6 +610,13 @@ void UpdateTexture(Texture2D texture, const void *pixels)
     rlUpdateTexture(texture.id, texture.width, texture.height, texture.format, pixels);
 }
 
+// Update GPU texture with new data, without waiting for the transfer (pixel buffer objects)
+// NOTE: pixels data must match texture.format, data is copied so it can be reused right after the call
+void UpdateTextureAsync(Texture2D texture, const void *pixels)
+{
+    rlUpdateTextureAsync(texture.id, texture.width, texture.height, texture.format, pixels);
+}
+
 // Copy an image to a new image
 Image ImageCopy(Image image)
 {
@@ -1130,6 +1138,8 @@ void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangl
 
 // Draw a part of a texture (defined by a rectangle) with 'pro' parameters
 // NOTE: origin is relative to destination rectangle size
+// NOTE: Quad corners are computed directly (no matrix stack usage), with specialized paths for
+// non-rotated quads (most common case) and rotated quads (only one sin/cos computation)
 void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint)
 {
     // Check if texture is valid
@@ -1143,43 +1153,100 @@ void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, V
         if (sourceRec.width < 0) { flipX = true; sourceRec.width *= -1; }
         if (sourceRec.height < 0) sourceRec.y -= sourceRec.height;
 
+        Vector2 topLeft = { 0 };
+        Vector2 topRight = { 0 };
+        Vector2 bottomLeft = { 0 };
+        Vector2 bottomRight = { 0 };
+
+        if (rotation == 0.0f)
+        {
+            // Non-rotated quad: corners are destination rectangle displaced by origin
+            // NOTE: Unscaled quads (destRec size equal to sourceRec size) also follow this path, no operation required for scale
+            float x = destRec.x - origin.x;
+            float y = destRec.y - origin.y;
+
+            topLeft = (Vector2){ x, y };
+            topRight = (Vector2){ x + destRec.width, y };
+            bottomLeft = (Vector2){ x, y + destRec.height };
+            bottomRight = (Vector2){ x + destRec.width, y + destRec.height };
+        }
+        else
+        {
+            // Rotated quad: corners rotated around destination position (same result than rlRotatef() around Z axis)
+            float sinRotation = sinf(rotation*DEG2RAD);
+            float cosRotation = cosf(rotation*DEG2RAD);
+            float dx = -origin.x;
+            float dy = -origin.y;
+
+            topLeft.x = destRec.x + dx*cosRotation - dy*sinRotation;
+            topLeft.y = destRec.y + dx*sinRotation + dy*cosRotation;
+
+            topRight.x = destRec.x + (dx + destRec.width)*cosRotation - dy*sinRotation;
+            topRight.y = destRec.y + (dx + destRec.width)*sinRotation + dy*cosRotation;
+
+            bottomLeft.x = destRec.x + dx*cosRotation - (dy + destRec.height)*sinRotation;
+            bottomLeft.y = destRec.y + dx*sinRotation + (dy + destRec.height)*cosRotation;
+
+            bottomRight.x = destRec.x + (dx + destRec.width)*cosRotation - (dy + destRec.height)*sinRotation;
+            bottomRight.y = destRec.y + (dx + destRec.width)*sinRotation + (dy + destRec.height)*cosRotation;
+        }
+
+        float left = sourceRec.x/width;
+        float right = (sourceRec.x + sourceRec.width)/width;
+        float top = sourceRec.y/height;
+        float bottom = (sourceRec.y + sourceRec.height)/height;
+
+        if (flipX) { float temp = left; left = right; right = temp; }
+
+        // Quad rejected if fully outside visible area (only if view culling is enabled)
+        float xmin = fminf(fminf(topLeft.x, topRight.x), fminf(bottomLeft.x, bottomRight.x));
+        float ymin = fminf(fminf(topLeft.y, topRight.y), fminf(bottomLeft.y, bottomRight.y));
+        float xmax = fmaxf(fmaxf(topLeft.x, topRight.x), fmaxf(bottomLeft.x, bottomRight.x));
+        float ymax = fmaxf(fmaxf(topLeft.y, topRight.y), fmaxf(bottomLeft.y, bottomRight.y));
+
+        if (rlCheckViewCulled(xmin, ymin, xmax, ymax)) return;
+
         rlEnableTexture(texture.id);
 
-        rlPushMatrix();
-            rlTranslatef(destRec.x, destRec.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+        rlBegin(RL_QUADS);
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+            // Bottom-left corner for texture and quad
+            rlTexCoord2f(left, top);
+            rlVertex2f(topLeft.x, topLeft.y);
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
-                else rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
-                rlVertex2f(0.0f, 0.0f);
-
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
-                else rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
-                rlVertex2f(0.0f, destRec.height);
-
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
-                else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
-                rlVertex2f(destRec.width, destRec.height);
-
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
-                else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
-                rlVertex2f(destRec.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
+            // Bottom-right corner for texture and quad
+            rlTexCoord2f(left, bottom);
+            rlVertex2f(bottomLeft.x, bottomLeft.y);
+
+            // Top-right corner for texture and quad
+            rlTexCoord2f(right, bottom);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+
+            // Top-left corner for texture and quad
+            rlTexCoord2f(right, top);
+            rlVertex2f(topRight.x, topRight.y);
+        rlEnd();
 
         rlDisableTexture();
     }
 }
 
+// Draw multiple parts of a texture with 'pro' parameters
+// NOTE: Instances are drawn with GPU instancing if supported, DrawTexturePro() is used otherwise
+void DrawTextureInstanced(Texture2D texture, const SpriteInstance *instances, int count)
+{
+    // Check if texture is valid
+    if ((texture.id > 0) && (count > 0))
+    {
+        if (!rlDrawSpriteInstances(texture.id, texture.width, texture.height, instances, count))
+        {
+            for (int i = 0; i < count; i++) DrawTexturePro(texture, instances[i].sourceRec, instances[i].destRec, instances[i].origin, instances[i].rotation, instances[i].tint);
+        }
+    }
+}
+
 // Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
 void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle destRec, Vector2 origin, float rotation, Color tint)
 {